@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 
 template <typename Type>
@@ -22,6 +23,11 @@ public:
     //  
     ArrayPtr(const ArrayPtr&) = delete;
 
+    //    , other  
+    ArrayPtr(ArrayPtr&& other) noexcept
+        : raw_ptr_(std::exchange(other.raw_ptr_, nullptr))
+    {}
+
     ~ArrayPtr() {
         //   
         delete[] raw_ptr_;
@@ -30,6 +36,14 @@ public:
     //  
     ArrayPtr& operator=(const ArrayPtr&) = delete;
 
+    ArrayPtr& operator=(ArrayPtr&& rhs) noexcept {
+        if (this != &rhs) {
+            ArrayPtr tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
     //     ,    
     //        
     [[nodiscard]] Type* Release() noexcept {
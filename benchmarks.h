@@ -0,0 +1,783 @@
+#pragma once
+
+#include "log_duration.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+//  :     pos     pos
+struct EditOperation {
+    bool is_insert;
+    size_t pos;
+    int value;
+};
+
+//        initial_size.
+// max_step ,        :
+// 0      , 1    
+inline std::vector<EditOperation> GenerateEdits(size_t initial_size, size_t count, size_t max_step, std::mt19937& generator) {
+    std::vector<EditOperation> edits;
+    edits.reserve(count);
+    size_t size = initial_size;
+    size_t cursor = size / 2;
+    for (size_t i = 0; i < count; ++i) {
+        if (max_step == 0) {
+            cursor = std::uniform_int_distribution<size_t>(0, size)(generator);
+        } else if (max_step > 1) {
+            const auto step = std::uniform_int_distribution<int64_t>(-static_cast<int64_t>(max_step), static_cast<int64_t>(max_step))(generator);
+            cursor = static_cast<size_t>(std::clamp<int64_t>(static_cast<int64_t>(cursor) + step, 0, static_cast<int64_t>(size)));
+        }
+        //     ,    
+        const bool is_insert = size == 0 || cursor == size || std::uniform_int_distribution<int>(0, 3)(generator) != 0;
+        edits.push_back({ is_insert, cursor, static_cast<int>(i) });
+        if (is_insert) {
+            ++size;
+            if (max_step == 1) {
+                ++cursor;
+            }
+        } else {
+            --size;
+        }
+    }
+    return edits;
+}
+
+template <typename Vector>
+int64_t ApplyEdits(Vector& v, const std::vector<EditOperation>& edits) {
+    for (const EditOperation& edit : edits) {
+        if (edit.is_insert) {
+            v.Insert(v.begin() + edit.pos, edit.value);
+        } else {
+            v.Erase(v.begin() + edit.pos);
+        }
+    }
+    int64_t checksum = 0;
+    for (const int value : v) {
+        checksum = checksum * 31 + value;
+    }
+    return checksum;
+}
+
+inline void BenchmarkGapVector() {
+    using namespace std;
+    cout << "BenchmarkGapVector"s << endl;
+
+    const size_t initial_size = 100000;
+    const size_t edit_count = 20000;
+    const struct {
+        string name;
+        size_t max_step;
+    } patterns[] = { { "random"s, 0 }, { "clustered"s, 16 }, { "sequential"s, 1 } };
+
+    mt19937 generator(42);
+    for (const auto& pattern : patterns) {
+        const auto edits = GenerateEdits(initial_size, edit_count, pattern.max_step, generator);
+
+        SimpleVector<int> simple(initial_size);
+        GapVector<int> gap(initial_size);
+        int64_t simple_checksum = 0;
+        int64_t gap_checksum = 0;
+        {
+            LOG_DURATION_STREAM("  SimpleVector, "s + pattern.name, cout);
+            simple_checksum = ApplyEdits(simple, edits);
+        }
+        {
+            LOG_DURATION_STREAM("  GapVector, "s + pattern.name, cout);
+            gap_checksum = ApplyEdits(gap, edits);
+        }
+        //  ,          assert
+        cout << "  checksum "s << simple_checksum;
+        if (gap_checksum != simple_checksum) {
+            cout << ", GapVector MISMATCH "s << gap_checksum;
+        }
+        cout << endl;
+    }
+    cout << endl;
+}
+
+//    :           
+inline void BenchmarkRingVector() {
+    using namespace std;
+    cout << "BenchmarkRingVector"s << endl;
+
+    const size_t window = 256;
+    const int operation_count = 1000000;
+
+    int64_t simple_sum = 0;
+    int64_t deque_sum = 0;
+    int64_t ring_sum = 0;
+    {
+        LOG_DURATION_STREAM("  SimpleVector, PushBack + Erase(begin())"s, cout);
+        SimpleVector<int> queue(Reserve(window + 1));
+        for (int i = 0; i < operation_count; ++i) {
+            queue.PushBack(i);
+            if (queue.GetSize() > window) {
+                simple_sum += *queue.begin();
+                queue.Erase(queue.begin());
+            }
+        }
+    }
+    {
+        LOG_DURATION_STREAM("  std::deque, push_back + pop_front"s, cout);
+        deque<int> queue;
+        for (int i = 0; i < operation_count; ++i) {
+            queue.push_back(i);
+            if (queue.size() > window) {
+                deque_sum += queue.front();
+                queue.pop_front();
+            }
+        }
+    }
+    {
+        LOG_DURATION_STREAM("  RingVector, PushBack + PopFront"s, cout);
+        RingVector<int> queue(Reserve(window + 1));
+        for (int i = 0; i < operation_count; ++i) {
+            queue.PushBack(i);
+            if (queue.GetSize() > window) {
+                ring_sum += queue.Front();
+                queue.PopFront();
+            }
+        }
+    }
+    {
+        LOG_DURATION_STREAM("  RingVector, Overwrite"s, cout);
+        RingVector<int> queue(Reserve(window), RingOverflow::Overwrite);
+        for (int i = 0; i < operation_count; ++i) {
+            queue.PushBack(i);
+        }
+        assert(queue.Front() == operation_count - static_cast<int>(window));
+    }
+    assert(simple_sum == deque_sum && deque_sum == ring_sum);
+    cout << endl;
+}
+
+//      func  
+template <typename Func>
+double MeasureNanosecondsPerCall(size_t call_count, Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < call_count; ++i) {
+        func(i);
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(call_count);
+}
+
+inline void BenchmarkCompressedVector() {
+    using namespace std;
+    cout << "BenchmarkCompressedVector"s << endl;
+
+    const size_t size = 4'000'000;
+    mt19937_64 generator(42);
+
+    //        
+    SimpleVector<uint64_t> plain(Reserve(size));
+    CompressedVector<uint64_t> compressed;
+    uint64_t timestamp = 1'600'000'000'000'000ull;
+    for (size_t i = 0; i < size; ++i) {
+        timestamp += uniform_int_distribution<uint64_t>(0, 5000)(generator);
+        plain.PushBack(timestamp);
+        compressed.PushBack(timestamp);
+    }
+    cout << "  bits per element: SimpleVector 64, CompressedVector "s << compressed.GetBitsPerElement() << endl;
+
+    uint64_t plain_sum = 0;
+    uint64_t iterator_sum = 0;
+    uint64_t decode_sum = 0;
+    {
+        LOG_DURATION_STREAM("  scan, SimpleVector"s, cout);
+        for (const uint64_t value : plain) {
+            plain_sum += value;
+        }
+    }
+    {
+        LOG_DURATION_STREAM("  scan, CompressedVector iterator"s, cout);
+        for (const uint64_t value : compressed) {
+            iterator_sum += value;
+        }
+    }
+    {
+        LOG_DURATION_STREAM("  scan, CompressedVector::Decode"s, cout);
+        const size_t chunk = 4096;
+        SimpleVector<uint64_t> buffer(chunk);
+        for (size_t first = 0; first < size; first += chunk) {
+            const size_t count = min(chunk, size - first);
+            compressed.Decode(first, count, buffer.begin());
+            for (size_t i = 0; i < count; ++i) {
+                decode_sum += buffer[i];
+            }
+        }
+    }
+    //  ,          assert
+    cout << "  scan checksum "s << plain_sum;
+    if (iterator_sum != plain_sum || decode_sum != plain_sum) {
+        cout << ", CompressedVector MISMATCH "s << iterator_sum << " / "s << decode_sum;
+    }
+    cout << endl;
+
+    const size_t lookup_count = 1'000'000;
+    SimpleVector<size_t> indices(Reserve(lookup_count));
+    for (size_t i = 0; i < lookup_count; ++i) {
+        indices.PushBack(uniform_int_distribution<size_t>(0, size - 1)(generator));
+    }
+    uint64_t plain_lookup_sum = 0;
+    uint64_t compressed_lookup_sum = 0;
+    cout << "  random access, SimpleVector: "s
+         << MeasureNanosecondsPerCall(lookup_count, [&](size_t i) { plain_lookup_sum += plain[indices[i]]; }) << " ns"s << endl;
+    cout << "  random access, CompressedVector: "s
+         << MeasureNanosecondsPerCall(lookup_count, [&](size_t i) { compressed_lookup_sum += compressed[indices[i]]; }) << " ns"s << endl;
+    cout << "  random access checksum "s << plain_lookup_sum;
+    if (compressed_lookup_sum != plain_lookup_sum) {
+        cout << ", CompressedVector MISMATCH "s << compressed_lookup_sum;
+    }
+    cout << endl << endl;
+}
+
+//    percent (0..100)   
+inline double Percentile(std::vector<double> samples, double percent) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    const size_t index = std::min(samples.size() - 1, static_cast<size_t>(percent / 100.0 * samples.size()));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+//  reader_count ,    read_count   make_read(thread)(i),
+//      update_period  update.     p99
+inline void RunConcurrentReadBenchmark(const std::string& name, size_t reader_count, size_t read_count,
+                                       std::chrono::microseconds update_period,
+                                       const std::function<std::function<int64_t(size_t)>()>& make_read,
+                                       const std::function<void(int)>& update) {
+    using namespace std;
+    using Clock = chrono::steady_clock;
+
+    atomic<bool> stop{ false };
+    atomic<int64_t> checksum{ 0 };
+    vector<vector<double>> latencies(reader_count);
+    size_t update_count = 0;
+
+    const auto start = Clock::now();
+    thread writer([&] {
+        int version = 1;
+        while (!stop.load()) {
+            update(version++);
+            ++update_count;
+            this_thread::sleep_for(update_period);
+        }
+    });
+    vector<thread> readers;
+    for (size_t t = 0; t < reader_count; ++t) {
+        readers.emplace_back([&, t] {
+            auto read = make_read();
+            vector<double>& samples = latencies[t];
+            samples.reserve(read_count);
+            int64_t sum = 0;
+            for (size_t i = 0; i < read_count; ++i) {
+                const auto read_start = Clock::now();
+                sum += read(i);
+                samples.push_back(chrono::duration<double, nano>(Clock::now() - read_start).count());
+            }
+            checksum += sum;
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    const chrono::duration<double> elapsed = Clock::now() - start;
+    stop = true;
+    writer.join();
+
+    vector<double> all_samples;
+    for (const auto& samples : latencies) {
+        all_samples.insert(all_samples.end(), samples.begin(), samples.end());
+    }
+    cout << "  "s << name << ": "s
+         << static_cast<double>(reader_count * read_count) / elapsed.count() / 1e6 << " M reads/s, p50 "s
+         << Percentile(all_samples, 50) << " ns, p99 "s
+         << Percentile(all_samples, 99) << " ns, updates "s << update_count
+         << " (checksum "s << checksum.load() << ")"s << endl;
+}
+
+inline void BenchmarkSnapshotVector() {
+    using namespace std;
+    cout << "BenchmarkSnapshotVector"s << endl;
+
+    const size_t table_size = 100000;
+    const size_t reader_count = 4;
+    const size_t read_count = 1'000'000;
+    const auto update_period = chrono::microseconds(500);
+
+    auto build_table = [table_size](int version) {
+        SimpleVector<int> table(Reserve(table_size));
+        for (size_t i = 0; i < table_size; ++i) {
+            table.PushBack(version);
+        }
+        return table;
+    };
+
+    {
+        SimpleVector<int> table = build_table(0);
+        shared_mutex mutex;
+        RunConcurrentReadBenchmark("shared_mutex + SimpleVector"s, reader_count, read_count, update_period,
+            [&] {
+                return [&](size_t i) -> int64_t {
+                    shared_lock lock(mutex);
+                    return table[i % table.GetSize()];
+                };
+            },
+            [&](int version) {
+                SimpleVector<int> rebuilt = build_table(version);
+                unique_lock lock(mutex);
+                table = move(rebuilt);
+            });
+    }
+    {
+        SnapshotVector<int> table(build_table(0));
+        RunConcurrentReadBenchmark("SnapshotVector"s, reader_count, read_count, update_period,
+            [&] {
+                auto reader = make_shared<SnapshotVector<int>::Reader>(table.RegisterReader());
+                return [reader](size_t i) -> int64_t {
+                    const auto snapshot = reader->Acquire();
+                    return snapshot[i % snapshot.GetSize()];
+                };
+            },
+            [&](int version) {
+                table.Publish(build_table(version));
+            });
+    }
+    cout << endl;
+}
+
+template <typename Key, typename Generator>
+void BenchmarkSortDistribution(const std::string& name, size_t size, Generator generate) {
+    using namespace std;
+
+    SimpleVector<Key> source(Reserve(size));
+    for (size_t i = 0; i < size; ++i) {
+        source.PushBack(generate());
+    }
+    SimpleVector<Key> expected(source);
+    SimpleVector<Key> scratch;
+    const string prefix = "  "s + name + ", "s + to_string(size) + ": "s;
+
+    {
+        LOG_DURATION_STREAM(prefix + "std::sort"s, cout);
+        sort(expected.begin(), expected.end());
+    }
+    SimpleVector<Key> keys(source);
+    {
+        LOG_DURATION_STREAM(prefix + "RadixSort"s, cout);
+        RadixSort(keys, scratch);
+    }
+    assert(keys == expected);
+    keys = source;
+    {
+        LOG_DURATION_STREAM(prefix + "MsdRadixSort"s, cout);
+        MsdRadixSort(keys);
+    }
+    assert(keys == expected);
+    keys = source;
+    {
+        LOG_DURATION_STREAM(prefix + "ParallelRadixSort"s, cout);
+        ParallelRadixSort(keys, scratch);
+    }
+    assert(keys == expected);
+}
+
+inline void BenchmarkRadixSort() {
+    using namespace std;
+    cout << "BenchmarkRadixSort"s << endl;
+
+    mt19937_64 generator(42);
+    for (const size_t size : { size_t{ 10'000 }, size_t{ 1'000'000 }, size_t{ 8'000'000 } }) {
+        BenchmarkSortDistribution<uint32_t>("uint32 uniform"s, size, [&] {
+            return static_cast<uint32_t>(generator());
+        });
+        BenchmarkSortDistribution<uint64_t>("uint64 uniform"s, size, [&] {
+            return generator();
+        });
+        BenchmarkSortDistribution<uint64_t>("uint64 small range"s, size, [&] {
+            return generator() % 1000;
+        });
+        BenchmarkSortDistribution<float>("float normal"s, size, [&] {
+            return normal_distribution<float>(0.0f, 1000.0f)(generator);
+        });
+    }
+    cout << endl;
+}
+
+inline void BenchmarkExternalVector() {
+    using namespace std;
+    using Clock = chrono::steady_clock;
+    cout << "BenchmarkExternalVector"s << endl;
+
+    const size_t size = 8'000'000;
+    const size_t data_bytes = size * sizeof(uint64_t);
+    const size_t random_reads = 20000;
+
+    for (const double ratio : { 1.0 / 64, 1.0 / 8, 1.0 / 2, 1.25 }) {
+        ExternalVectorOptions options;
+        options.ram_budget_bytes = static_cast<size_t>(data_bytes * ratio);
+        ExternalVector<uint64_t> v(options);
+        for (uint64_t i = 0; i < size; ++i) {
+            v.PushBack(i);
+        }
+        v.Flush();
+        v.ResetStats();
+
+        //     ,     ,    
+        const ExternalVector<uint64_t>& reader = v;
+
+        const auto scan_start = Clock::now();
+        uint64_t sum = 0;
+        for (const uint64_t value : reader) {
+            sum += value;
+        }
+        const chrono::duration<double> scan_time = Clock::now() - scan_start;
+        assert(sum == size * (size - 1) / 2);
+        const ExternalVectorStats scan_stats = v.GetStats();
+
+        mt19937_64 generator(42);
+        const auto random_start = Clock::now();
+        for (size_t i = 0; i < random_reads; ++i) {
+            sum += reader[uniform_int_distribution<size_t>(0, size - 1)(generator)];
+        }
+        const chrono::duration<double> random_time = Clock::now() - random_start;
+
+        cout << "  budget/size "s << ratio
+             << ": scan "s << static_cast<double>(size) / scan_time.count() / 1e6 << " M elements/s ("s
+             << scan_stats.blocks_read << " blocks in "s << scan_stats.file_reads << " file reads), random "s
+             << static_cast<double>(random_reads) / random_time.count() / 1e6 << " M reads/s ("s
+             << v.GetStats().blocks_written << " blocks written, checksum "s << sum << ")"s << endl;
+    }
+    cout << endl;
+}
+
+//          
+inline void PrintLatencyHistogram(const std::string& name, const std::vector<uint64_t>& latencies) {
+    using namespace std;
+    static const uint64_t bounds[] = { 64, 256, 1'000, 10'000, 100'000, 1'000'000 };
+    static const char* const labels[] = { "<64ns", "<256ns", "<1us", "<10us", "<100us", "<1ms", ">=1ms" };
+    size_t counts[size(labels)] = {};
+    uint64_t max_latency = 0;
+    for (const uint64_t latency : latencies) {
+        const size_t bucket = static_cast<size_t>(upper_bound(begin(bounds), end(bounds), latency) - begin(bounds));
+        ++counts[bucket];
+        max_latency = max(max_latency, latency);
+    }
+    cout << "  "s << name << ':';
+    for (size_t i = 0; i < size(labels); ++i) {
+        cout << ' ' << labels[i] << ' ' << counts[i];
+    }
+    cout << ", max "s << static_cast<double>(max_latency) / 1e6 << " ms"s << endl;
+}
+
+template <typename Vector>
+std::vector<uint64_t> MeasurePushBackLatencies(Vector& v, size_t count) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<uint64_t> latencies(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto start = Clock::now();
+        v.PushBack(static_cast<int>(i));
+        latencies[i] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+    return latencies;
+}
+
+inline void BenchmarkIncrementalVector() {
+    using namespace std;
+    cout << "BenchmarkIncrementalVector"s << endl;
+
+    const size_t count = 20'000'000;
+    {
+        SimpleVector<int> v;
+        PrintLatencyHistogram("SimpleVector::PushBack"s, MeasurePushBackLatencies(v, count));
+    }
+    {
+        IncrementalVector<int> v;
+        PrintLatencyHistogram("IncrementalVector::PushBack"s, MeasurePushBackLatencies(v, count));
+    }
+    {
+        //   operator[]       
+        SimpleVector<int> simple;
+        IncrementalVector<int> incremental;
+        for (size_t i = 0; i < count; ++i) {
+            simple.PushBack(static_cast<int>(i));
+            incremental.PushBack(static_cast<int>(i));
+        }
+        int64_t simple_sum = 0;
+        int64_t incremental_sum = 0;
+        {
+            LOG_DURATION_STREAM("  read, SimpleVector::operator[]"s, cout);
+            for (size_t i = 0; i < count; ++i) {
+                simple_sum += simple[i];
+            }
+        }
+        {
+            LOG_DURATION_STREAM("  read, IncrementalVector::operator[]"s, cout);
+            for (size_t i = 0; i < count; ++i) {
+                incremental_sum += incremental[i];
+            }
+        }
+        //  ,          assert
+        cout << "  read checksum "s << simple_sum;
+        if (incremental_sum != simple_sum) {
+            cout << ", IncrementalVector MISMATCH "s << incremental_sum;
+        }
+        cout << endl;
+    }
+    cout << endl;
+}
+
+//       ;       
+inline void BenchmarkBufferPool() {
+    using namespace std;
+    cout << "BenchmarkBufferPool"s << endl;
+
+    const size_t rounds = 50'000;
+    const size_t vectors_per_round = 16;
+    vector<size_t> sizes(vectors_per_round);
+
+    for (const bool pooled : { false, true }) {
+        mt19937 generator(42);
+        BufferPool::Trim();
+        if (pooled) {
+            BufferPool::ResetBucketLimits();
+        } else {
+            BufferPool::SetBucketLimits(0);
+        }
+        BufferPool::ResetStats();
+
+        int64_t checksum = 0;
+        {
+            LOG_DURATION_STREAM(pooled ? "  churn, with pool"s : "  churn, without pool"s, cout);
+            for (size_t round = 0; round < rounds; ++round) {
+                for (size_t& size : sizes) {
+                    size = uniform_int_distribution<size_t>(16, 2'000)(generator);
+                }
+                SimpleVector<SimpleVector<int>> batch;
+                for (const size_t size : sizes) {
+                    SimpleVector<int> v;
+                    for (size_t i = 0; i < size; ++i) {
+                        v.PushBack(static_cast<int>(i));
+                    }
+                    checksum += v[size / 2];
+                    batch.PushBack(std::move(v));
+                }
+            }
+        }
+        const BufferPoolStats stats = BufferPool::GetStats();
+        cout << "    hits "s << stats.hits << ", misses "s << stats.misses
+             << ", checksum "s << checksum << endl;
+    }
+    BufferPool::ResetBucketLimits();
+    BufferPool::Trim();
+    cout << endl;
+}
+
+// r = a * 2 + b - c * d:     ,     
+inline void BenchmarkVectorExpression() {
+    using namespace std;
+    cout << "BenchmarkVectorExpression"s << endl;
+
+    const size_t size = 4'000'000;
+    const int repeat = 20;
+    SimpleVector<double> a(size), b(size), c(size), d(size);
+    mt19937_64 generator(42);
+    uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = distribution(generator);
+        b[i] = distribution(generator);
+        c[i] = distribution(generator);
+        d[i] = distribution(generator);
+    }
+
+    //    ,   
+    auto apply = [](const SimpleVector<double>& lhs, const SimpleVector<double>& rhs, auto operation) {
+        SimpleVector<double> result(lhs.GetSize());
+        for (size_t i = 0; i < lhs.GetSize(); ++i) {
+            result[i] = operation(lhs[i], rhs[i]);
+        }
+        return result;
+    };
+    auto scale = [](const SimpleVector<double>& v, double factor) {
+        SimpleVector<double> result(v.GetSize());
+        for (size_t i = 0; i < v.GetSize(); ++i) {
+            result[i] = v[i] * factor;
+        }
+        return result;
+    };
+
+    SimpleVector<double> expected(size);
+    {
+        LOG_DURATION_STREAM("  temporaries"s, cout);
+        for (int i = 0; i < repeat; ++i) {
+            expected = apply(apply(scale(a, 2.0), b, plus<>()), apply(c, d, multiplies<>()), minus<>());
+        }
+    }
+
+    SimpleVector<double> r(size);
+    {
+        LOG_DURATION_STREAM("  hand-written loop"s, cout);
+        for (int i = 0; i < repeat; ++i) {
+            for (size_t j = 0; j < size; ++j) {
+                r[j] = a[j] * 2.0 + b[j] - c[j] * d[j];
+            }
+        }
+    }
+    assert(r == expected);
+    {
+        LOG_DURATION_STREAM("  expression"s, cout);
+        for (int i = 0; i < repeat; ++i) {
+            r = a * 2.0 + b - c * d;
+        }
+    }
+    assert(r == expected);
+    {
+        LOG_DURATION_STREAM("  expression, Parallel"s, cout);
+        for (int i = 0; i < repeat; ++i) {
+            r = Parallel(a * 2.0 + b - c * d);
+        }
+    }
+    assert(r == expected);
+    cout << endl;
+}
+
+//         1M     
+inline void BenchmarkSparseVector() {
+    using namespace std;
+    using Clock = chrono::steady_clock;
+    cout << "BenchmarkSparseVector"s << endl;
+
+    const size_t size = 1'000'000;
+    const int repeat = 50;
+    mt19937_64 generator(42);
+    SimpleVector<float> weights(size);
+    for (float& weight : weights) {
+        weight = uniform_real_distribution<float>(-1.0f, 1.0f)(generator);
+    }
+
+    for (const double density : { 0.001, 0.01, 0.1, 0.5 }) {
+        SimpleVector<float> dense(size);
+        for (size_t i = 0; i < size; ++i) {
+            if (uniform_real_distribution<double>(0.0, 1.0)(generator) < density) {
+                dense[i] = 1.0f;
+            }
+        }
+        const SparseVector<float> sparse(dense);
+
+        float dense_sum = 0.0f;
+        const auto dense_start = Clock::now();
+        for (int r = 0; r < repeat; ++r) {
+            float sum = 0.0f;
+            for (size_t i = 0; i < size; ++i) {
+                sum += dense[i] * weights[i];
+            }
+            dense_sum += sum;
+        }
+        const chrono::duration<double> dense_time = Clock::now() - dense_start;
+
+        float sparse_sum = 0.0f;
+        const auto sparse_start = Clock::now();
+        for (int r = 0; r < repeat; ++r) {
+            sparse_sum += Dot(sparse, weights);
+        }
+        const chrono::duration<double> sparse_time = Clock::now() - sparse_start;
+
+        cout << "  density "s << density << (sparse.IsDense() ? " (dense mode)"s : ""s)
+             << ": memory SimpleVector "s << dense.GetCapacity() * sizeof(float) / 1024 << " KiB, SparseVector "s
+             << sparse.GetMemoryUsage() / 1024 << " KiB; dot SimpleVector "s
+             << dense_time.count() * 1e3 / repeat << " ms, SparseVector "s
+             << sparse_time.count() * 1e3 / repeat << " ms (sums "s << dense_sum << " / "s << sparse_sum << ')' << endl;
+    }
+    cout << endl;
+}
+
+//  ,      std::hash<SimpleVector>
+struct PerElementVectorHash {
+    template <typename Type>
+    size_t operator()(const SimpleVector<Type>& vector) const {
+        size_t seed = vector.GetSize();
+        for (const Type& value : vector) {
+            seed ^= std::hash<Type>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+
+//     keys  queries[order[0]], queries[order[1]], ...
+template <typename Map, typename Key>
+void BenchmarkLookups(const std::string& name, const std::vector<Key>& keys, const std::vector<Key>& queries,
+                      const std::vector<size_t>& order) {
+    using namespace std;
+    Map map;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map.emplace(keys[i], i);
+    }
+    size_t found = 0;
+    const auto start = chrono::steady_clock::now();
+    for (const size_t index : order) {
+        found += map.count(queries[index]);
+    }
+    const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    // found ,          assert
+    cout << "  "s << name << ": "s << static_cast<double>(order.size()) / elapsed.count() / 1e6 << " M lookups/s"s
+         << " (found "s << found << " of "s << order.size() << ")"s << endl;
+}
+
+template <typename Type>
+void BenchmarkHashDistribution(const std::string& name, size_t key_length) {
+    using namespace std;
+    const size_t key_count = 20'000;
+    const size_t query_count = 200'000;
+    mt19937_64 generator(42);
+
+    vector<SimpleVector<Type>> keys;
+    for (size_t i = 0; i < key_count; ++i) {
+        SimpleVector<Type> key(key_length);
+        for (Type& value : key) {
+            value = static_cast<Type>(generator());
+        }
+        keys.push_back(std::move(key));
+    }
+    //    ,          
+    const vector<SimpleVector<Type>> queries = keys;
+    vector<size_t> order;
+    for (size_t i = 0; i < query_count; ++i) {
+        order.push_back(generator() % key_count);
+    }
+    vector<HashedVector<Type>> hashed_keys;
+    vector<HashedVector<Type>> hashed_queries;
+    for (size_t i = 0; i < key_count; ++i) {
+        hashed_keys.emplace_back(keys[i]);
+        hashed_queries.emplace_back(queries[i]);
+        //   ,        :
+        //    ,     
+        hashed_queries.back().GetHash();
+    }
+
+    cout << ' ' << name << ", "s << key_length * sizeof(Type) << " bytes per key"s << endl;
+    BenchmarkLookups<unordered_map<SimpleVector<Type>, size_t, PerElementVectorHash>>("per-element hash"s, keys, queries, order);
+    BenchmarkLookups<unordered_map<SimpleVector<Type>, size_t>>("std::hash<SimpleVector>"s, keys, queries, order);
+    BenchmarkLookups<unordered_map<HashedVector<Type>, size_t>>("HashedVector, reused queries"s, hashed_keys, hashed_queries, order);
+}
+
+inline void BenchmarkHashedVector() {
+    using namespace std;
+    cout << "BenchmarkHashedVector"s << endl;
+    BenchmarkHashDistribution<uint8_t>("SimpleVector<uint8_t>"s, 1024);
+    BenchmarkHashDistribution<int32_t>("SimpleVector<int32_t>"s, 256);
+    cout << endl;
+}
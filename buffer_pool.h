@@ -0,0 +1,434 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+// ,  BufferPool: bytes   ,     Deallocate
+struct BufferPoolBlock {
+    void* data = nullptr;
+    size_t bytes = 0;
+};
+
+//      
+struct BufferPoolStats {
+    size_t hits = 0;      //        
+    size_t misses = 0;    //    
+    size_t recycled = 0;  //     
+    size_t released = 0;  //     ,    
+};
+
+//   ,     - .
+//        ,   
+//    ,        .
+//
+//     ,      .   
+//   ,     .   
+//      .      .
+//      MAX_POOLED_BYTES:   
+//         ,     
+//        .
+//
+//    : ,      (THREAD_CACHE_BYTES),
+//    ,      (GLOBAL_CACHE_BYTES)    .
+//      GLOBAL_CACHE_BYTES  THREAD_CACHE_BYTES  .
+// Trim        ,     
+//      
+class BufferPool {
+public:
+    //     ( -)
+    static constexpr size_t ALIGNMENT = 64;
+    //    64 ,   MAX_POOLED_BYTES = 16 
+    static constexpr size_t MIN_SHIFT = 6;
+    static constexpr size_t BUCKET_COUNT = 19;
+    static constexpr size_t MAX_POOLED_BYTES = size_t{ 1 } << (MIN_SHIFT + BUCKET_COUNT - 1);
+    //           
+    static constexpr size_t BUCKET_BUDGET_BYTES = size_t{ 2 } << 20;
+    //  ,           
+    static constexpr size_t THREAD_CACHE_BYTES = size_t{ 8 } << 20;
+    static constexpr size_t GLOBAL_CACHE_BYTES = size_t{ 32 } << 20;
+
+    //     bytes ,   ALIGNMENT.
+    //    ,    ;
+    //   MAX_POOLED_BYTES        
+    static BufferPoolBlock Allocate(size_t bytes) {
+        const size_t bucket = GetBucket(bytes);
+        //       
+        if (bucket == BUCKET_COUNT || GetLimits()[bucket].load(std::memory_order_relaxed) == 0) {
+            ++Stats().misses;
+            return { AllocateFromHeap(bytes), bytes };
+        }
+        const size_t bucket_bytes = GetBucketBytes(bucket);
+        if (Cache* local = GetLocalCache(); local != nullptr) {
+            if (void* block = local->Pop(bucket); block != nullptr) {
+                ++Stats().hits;
+                return { block, bucket_bytes };
+            }
+        }
+        {
+            Global& global = GetGlobal();
+            std::lock_guard guard(global.mutex);
+            if (void* block = global.cache.Pop(bucket); block != nullptr) {
+                ++Stats().hits;
+                return { block, bucket_bytes };
+            }
+        }
+        ++Stats().misses;
+        return { AllocateFromHeap(bucket_bytes), bucket_bytes };
+    }
+
+    //    .        ,
+    //  ,    ,     
+    static void Deallocate(BufferPoolBlock block) noexcept {
+        const size_t bucket = GetBucket(block.bytes);
+        const bool is_bucket_sized = bucket < BUCKET_COUNT && GetBucketBytes(bucket) == block.bytes;
+        const size_t limit = is_bucket_sized ? GetLimits()[bucket].load(std::memory_order_relaxed) : 0;
+        if (limit > 0) {
+            const Capacity& capacity = GetCapacity();
+            if (Cache* local = GetLocalCache();
+                local != nullptr && local->Push(bucket, block.data, limit, capacity.thread_bytes.load(std::memory_order_relaxed))) {
+                ++Stats().recycled;
+                return;
+            }
+            Global& global = GetGlobal();
+            std::lock_guard guard(global.mutex);
+            if (global.cache.Push(bucket, block.data, limit, capacity.global_bytes.load(std::memory_order_relaxed))) {
+                ++Stats().recycled;
+                return;
+            }
+        }
+        ++Stats().released;
+        ::operator delete(block.data, std::align_val_t{ ALIGNMENT });
+    }
+
+    // ,   ,  bytes ,  
+    //        .  0   .
+    // ,    ,    Trim
+    static void SetBucketLimit(size_t bytes, size_t max_blocks) noexcept {
+        const size_t bucket = GetBucket(bytes);
+        if (bucket < BUCKET_COUNT) {
+            GetLimits()[bucket].store(max_blocks, std::memory_order_relaxed);
+        }
+    }
+
+    //      
+    static void SetBucketLimits(size_t max_blocks) noexcept {
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            GetLimits()[bucket].store(max_blocks, std::memory_order_relaxed);
+        }
+    }
+
+    //    :    BUCKET_BUDGET_BYTES,    64 
+    static void ResetBucketLimits() noexcept {
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            GetLimits()[bucket].store(GetDefaultLimit(bucket), std::memory_order_relaxed);
+        }
+    }
+
+    // ,          .
+    // ,    ,    Trim
+    static void SetCacheCapacity(size_t thread_cache_bytes, size_t global_cache_bytes) noexcept {
+        Capacity& capacity = GetCapacity();
+        capacity.thread_bytes.store(thread_cache_bytes, std::memory_order_relaxed);
+        capacity.global_bytes.store(global_cache_bytes, std::memory_order_relaxed);
+    }
+
+    //     : THREAD_CACHE_BYTES  GLOBAL_CACHE_BYTES
+    static void ResetCacheCapacity() noexcept {
+        SetCacheCapacity(THREAD_CACHE_BYTES, GLOBAL_CACHE_BYTES);
+    }
+
+    //   ,  bytes 
+    static size_t GetBucketLimit(size_t bytes) noexcept {
+        const size_t bucket = GetBucket(bytes);
+        return bucket < BUCKET_COUNT ? GetLimits()[bucket].load(std::memory_order_relaxed) : 0;
+    }
+
+    //          .
+    //        Allocate/Deallocate  .
+    //  ,      
+    static void Trim() noexcept {
+        GetTrimEpoch().fetch_add(1, std::memory_order_relaxed);
+        if (Cache* local = GetLocalCache(); local != nullptr) {
+            local->Clear();
+        }
+        Global& global = GetGlobal();
+        std::lock_guard guard(global.mutex);
+        global.cache.Clear();
+    }
+
+    //           
+    static size_t GetCachedBytes() noexcept {
+        size_t bytes = 0;
+        if (Cache* local = GetLocalCache(); local != nullptr) {
+            bytes += local->GetBytes();
+        }
+        Global& global = GetGlobal();
+        std::lock_guard guard(global.mutex);
+        return bytes + global.cache.GetBytes();
+    }
+
+    //    
+    static BufferPoolStats GetStats() noexcept {
+        return Stats();
+    }
+
+    static void ResetStats() noexcept {
+        Stats() = {};
+    }
+
+    //       bytes   BUCKET_COUNT,    MAX_POOLED_BYTES
+    static size_t GetBucket(size_t bytes) noexcept {
+        size_t bucket = 0;
+        while (bucket < BUCKET_COUNT && GetBucketBytes(bucket) < bytes) {
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    static size_t GetBucketBytes(size_t bucket) noexcept {
+        return size_t{ 1 } << (MIN_SHIFT + bucket);
+    }
+
+private:
+    //           
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct Bucket {
+        FreeBlock* head = nullptr;
+        size_t count = 0;
+    };
+
+    struct Cache {
+        Bucket buckets[BUCKET_COUNT];
+        size_t bytes = 0;
+
+        void* Pop(size_t bucket) noexcept {
+            Bucket& list = buckets[bucket];
+            FreeBlock* block = list.head;
+            if (block != nullptr) {
+                list.head = block->next;
+                --list.count;
+                bytes -= GetBucketBytes(bucket);
+            }
+            return block;
+        }
+
+        //  ,     limit       max_bytes
+        bool Push(size_t bucket, void* memory, size_t limit, size_t max_bytes) noexcept {
+            Bucket& list = buckets[bucket];
+            const size_t bucket_bytes = GetBucketBytes(bucket);
+            if (list.count >= limit || bucket_bytes > max_bytes - std::min(bytes, max_bytes)) {
+                return false;
+            }
+            list.head = ::new (memory) FreeBlock{ list.head };
+            ++list.count;
+            bytes += bucket_bytes;
+            return true;
+        }
+
+        size_t GetBytes() const noexcept {
+            return bytes;
+        }
+
+        void Clear() noexcept {
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+                while (void* block = Pop(bucket)) {
+                    ::operator delete(block, std::align_val_t{ ALIGNMENT });
+                }
+            }
+        }
+    };
+
+    struct Global {
+        std::mutex mutex;
+        Cache cache;
+    };
+
+    //  .        
+    struct LocalCache {
+        Cache cache;
+        bool& destroyed;
+        //    Trim,     
+        size_t trim_epoch = GetTrimEpoch().load(std::memory_order_relaxed);
+
+        explicit LocalCache(bool& destroyed_flag) noexcept
+            : destroyed(destroyed_flag)
+        {}
+
+        ~LocalCache() {
+            destroyed = true;
+            Global& global = GetGlobal();
+            const size_t max_bytes = GetCapacity().global_bytes.load(std::memory_order_relaxed);
+            std::lock_guard guard(global.mutex);
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+                const size_t limit = GetLimits()[bucket].load(std::memory_order_relaxed);
+                while (void* block = cache.Pop(bucket)) {
+                    if (!global.cache.Push(bucket, block, limit, max_bytes)) {
+                        ::operator delete(block, std::align_val_t{ ALIGNMENT });
+                    }
+                }
+            }
+        }
+    };
+
+    //     nullptr,    
+    // (    thread_local   ).
+    //        Trim,   
+    static Cache* GetLocalCache() noexcept {
+        //         
+        thread_local bool destroyed = false;
+        thread_local LocalCache local(destroyed);
+        if (destroyed) {
+            return nullptr;
+        }
+        const size_t trim_epoch = GetTrimEpoch().load(std::memory_order_relaxed);
+        if (local.trim_epoch != trim_epoch) {
+            local.trim_epoch = trim_epoch;
+            local.cache.Clear();
+        }
+        return &local.cache;
+    }
+
+    //   Trim,       
+    static std::atomic<size_t>& GetTrimEpoch() noexcept {
+        static std::atomic<size_t> epoch{ 0 };
+        return epoch;
+    }
+
+    struct Capacity {
+        std::atomic<size_t> thread_bytes{ THREAD_CACHE_BYTES };
+        std::atomic<size_t> global_bytes{ GLOBAL_CACHE_BYTES };
+    };
+
+    static Capacity& GetCapacity() noexcept {
+        static Capacity* capacity = new Capacity();
+        return *capacity;
+    }
+
+    //     :       main
+    static Global& GetGlobal() noexcept {
+        static Global* global = new Global();
+        return *global;
+    }
+
+    static std::atomic<size_t>* GetLimits() noexcept {
+        static std::atomic<size_t>* limits = [] {
+            auto* result = new std::atomic<size_t>[BUCKET_COUNT];
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+                result[bucket].store(GetDefaultLimit(bucket), std::memory_order_relaxed);
+            }
+            return result;
+        }();
+        return limits;
+    }
+
+    static size_t GetDefaultLimit(size_t bucket) noexcept {
+        //      0   
+        return std::min<size_t>(BUCKET_BUDGET_BYTES / GetBucketBytes(bucket), 64);
+    }
+
+    static BufferPoolStats& Stats() noexcept {
+        thread_local BufferPoolStats stats;
+        return stats;
+    }
+
+    //         
+    static void* AllocateFromHeap(size_t bytes) {
+        try {
+            return ::operator new(bytes, std::align_val_t{ ALIGNMENT });
+        } catch (const std::bad_alloc&) {
+            Trim();
+            return ::operator new(bytes, std::align_val_t{ ALIGNMENT });
+        }
+    }
+};
+
+//   ,  ArrayPtr,     BufferPool    .
+//      ,   new Type[size]  delete[]
+template <typename Type>
+class PooledArrayPtr {
+    static_assert(alignof(Type) <= BufferPool::ALIGNMENT, "PooledArrayPtr does not support over-aligned types");
+
+public:
+    PooledArrayPtr() = default;
+
+    //    size   Type.  size == 0,   
+    explicit PooledArrayPtr(size_t size) {
+        if (size == 0) {
+            return;
+        }
+        if (size > SIZE_MAX / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        const BufferPoolBlock block = BufferPool::Allocate(size * sizeof(Type));
+        try {
+            std::uninitialized_default_construct_n(static_cast<Type*>(block.data), size);
+        } catch (...) {
+            BufferPool::Deallocate(block);
+            throw;
+        }
+        raw_ptr_ = static_cast<Type*>(block.data);
+        size_ = size;
+        allocated_bytes_ = block.bytes;
+    }
+
+    PooledArrayPtr(const PooledArrayPtr&) = delete;
+    PooledArrayPtr& operator=(const PooledArrayPtr&) = delete;
+
+    PooledArrayPtr(PooledArrayPtr&& other) noexcept
+        : raw_ptr_(std::exchange(other.raw_ptr_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+        , allocated_bytes_(std::exchange(other.allocated_bytes_, 0))
+    {}
+
+    PooledArrayPtr& operator=(PooledArrayPtr&& rhs) noexcept {
+        if (this != &rhs) {
+            PooledArrayPtr tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~PooledArrayPtr() {
+        if (raw_ptr_ != nullptr) {
+            std::destroy_n(raw_ptr_, size_);
+            BufferPool::Deallocate({ raw_ptr_, allocated_bytes_ });
+        }
+    }
+
+    Type& operator[](size_t index) noexcept {
+        return raw_ptr_[index];
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        return raw_ptr_[index];
+    }
+
+    explicit operator bool() const noexcept {
+        return raw_ptr_ != nullptr;
+    }
+
+    Type* Get() const noexcept {
+        return raw_ptr_;
+    }
+
+    void swap(PooledArrayPtr& other) noexcept {
+        std::swap(raw_ptr_, other.raw_ptr_);
+        std::swap(size_, other.size_);
+        std::swap(allocated_bytes_, other.allocated_bytes_);
+    }
+
+private:
+    Type* raw_ptr_ = nullptr;
+    size_t size_ = 0;
+    //   ,    BufferPool
+    size_t allocated_bytes_ = 0;
+};
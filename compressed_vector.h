@@ -0,0 +1,255 @@
+#pragma once
+
+#include "indexed_iterator.h"
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+
+//    .
+//      BLOCK_SIZE .    
+// (frame of reference)    ,     , 
+//    .     
+//      ,       64.
+//      ,  operator[]   O(1).
+//     ,   
+template <typename IntType>
+class CompressedVector {
+    static_assert(std::is_integral_v<IntType> && sizeof(IntType) <= sizeof(uint64_t),
+                  "CompressedVector supports integer types up to 64 bits");
+
+    using UnsignedType = std::make_unsigned_t<IntType>;
+
+    struct BlockHeader {
+        UnsignedType base = 0;  //   
+        size_t offset = 0;      //      words_
+        uint8_t width = 0;      //     
+    };
+
+public:
+    static constexpr size_t BLOCK_SIZE = 128;
+
+    using ConstIterator = IndexedIterator<const CompressedVector, const IntType, IntType>;
+    using Iterator = ConstIterator;
+
+    CompressedVector()
+        : tail_(Reserve(BLOCK_SIZE))
+    {}
+
+    CompressedVector(std::initializer_list<IntType> init)
+        : CompressedVector()
+    {
+        for (const IntType value : init) {
+            PushBack(value);
+        }
+    }
+
+    //     .
+    //  BLOCK_SIZE-    
+    void PushBack(IntType value) {
+        tail_.PushBack(value);
+        if (tail_.GetSize() == BLOCK_SIZE) {
+            PackBlock(tail_.begin());
+            tail_.Clear();
+        }
+    }
+
+    //     
+    void swap(CompressedVector& other) noexcept {
+        headers_.swap(other.headers_);
+        words_.swap(other.words_);
+        tail_.swap(other.tail_);
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return headers_.GetSize() * BLOCK_SIZE + tail_.GetSize();
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //  ,   
+    void Clear() noexcept {
+        headers_.Clear();
+        words_.Clear();
+        tail_.Clear();
+    }
+
+    //      index  O(1)
+    IntType operator[](size_t index) const noexcept {
+        const size_t block = index / BLOCK_SIZE;
+        if (block == headers_.GetSize()) {
+            return tail_[index % BLOCK_SIZE];
+        }
+        const BlockHeader& header = headers_[block];
+        return FromOffset(header.base, ExtractBits(words_.begin() + header.offset, index % BLOCK_SIZE, header.width));
+    }
+
+    //      index
+    //   std::out_of_range,  index >= size
+    IntType At(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    //  count ,   first,   out.
+    //      ,      operator[]
+    void Decode(size_t first, size_t count, IntType* out) const {
+        assert(first + count <= GetSize());
+        IntType buffer[BLOCK_SIZE];
+        while (count > 0) {
+            const size_t block = first / BLOCK_SIZE;
+            const size_t in_block = first % BLOCK_SIZE;
+            const size_t chunk = std::min(count, BLOCK_SIZE - in_block);
+            if (block == headers_.GetSize()) {
+                std::copy(tail_.begin() + in_block, tail_.begin() + in_block + chunk, out);
+            } else if (chunk == BLOCK_SIZE) {
+                UnpackBlock(block, out);
+            } else {
+                UnpackBlock(block, buffer);
+                std::copy(buffer + in_block, buffer + in_block + chunk, out);
+            }
+            first += chunk;
+            count -= chunk;
+            out += chunk;
+        }
+    }
+
+    //      :  ,    
+    size_t GetMemoryUsage() const noexcept {
+        return sizeof(*this)
+            + words_.GetCapacity() * sizeof(uint64_t)
+            + headers_.GetCapacity() * sizeof(BlockHeader)
+            + tail_.GetCapacity() * sizeof(IntType);
+    }
+
+    //          
+    double GetBitsPerElement() const noexcept {
+        if (IsEmpty()) {
+            return 0.0;
+        }
+        const size_t bytes = words_.GetSize() * sizeof(uint64_t)
+            + headers_.GetSize() * sizeof(BlockHeader)
+            + tail_.GetSize() * sizeof(IntType);
+        return 8.0 * static_cast<double>(bytes) / static_cast<double>(GetSize());
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, GetSize());
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    static uint64_t ToOffset(UnsignedType base, IntType value) noexcept {
+        return static_cast<UnsignedType>(static_cast<UnsignedType>(value) - base);
+    }
+
+    static IntType FromOffset(UnsignedType base, uint64_t offset) noexcept {
+        return static_cast<IntType>(static_cast<UnsignedType>(base + static_cast<UnsignedType>(offset)));
+    }
+
+    static uint8_t BitWidth(uint64_t value) noexcept {
+        uint8_t width = 0;
+        while (value != 0) {
+            ++width;
+            value >>= 1;
+        }
+        return width;
+    }
+
+    static uint64_t LowMask(uint8_t width) noexcept {
+        return width == 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << width) - 1;
+    }
+
+    //  width     index.     ,
+    //    .  (hi << 1) << (63 - shift)  0  shift == 0,
+    //       64
+    static uint64_t ExtractBits(const uint64_t* words, size_t index, uint8_t width) noexcept {
+        const size_t bit = index * width;
+        const size_t shift = bit % 64;
+        const uint64_t lo = words[bit / 64] >> shift;
+        const uint64_t hi = (words[bit / 64 + 1] << 1) << (63 - shift);
+        return (lo | hi) & LowMask(width);
+    }
+
+    //  BLOCK_SIZE    words_.
+    //    BLOCK_SIZE * width / 64 = 2 * width 
+    void PackBlock(const IntType* values) {
+        UnsignedType base = static_cast<UnsignedType>(*std::min_element(values, values + BLOCK_SIZE));
+        uint64_t max_offset = 0;
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            max_offset = std::max(max_offset, ToOffset(base, values[i]));
+        }
+
+        BlockHeader header;
+        header.base = base;
+        header.width = BitWidth(max_offset);
+        //         ,  ExtractBits
+        //           .
+        //       
+        header.offset = words_.IsEmpty() ? 0 : words_.GetSize() - 2;
+        const size_t word_count = BLOCK_SIZE * header.width / 64;
+        const size_t new_size = header.offset + word_count + 2;
+        if (new_size > words_.GetCapacity()) {
+            words_.Reserve(std::max(new_size, 2 * words_.GetCapacity()));
+        }
+        words_.Resize(new_size);
+
+        uint64_t* words = words_.begin() + header.offset;
+        for (size_t i = 0; i < BLOCK_SIZE && header.width > 0; ++i) {
+            const uint64_t offset = ToOffset(base, values[i]);
+            const size_t bit = i * header.width;
+            const size_t shift = bit % 64;
+            words[bit / 64] |= offset << shift;
+            if (shift + header.width > 64) {
+                words[bit / 64 + 1] |= offset >> (64 - shift);
+            }
+        }
+        headers_.PushBack(header);
+    }
+
+    //   .     
+    //    
+    void UnpackBlock(size_t block, IntType* out) const noexcept {
+        const BlockHeader header = headers_[block];
+        const uint64_t* words = words_.begin() + header.offset;
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            out[i] = FromOffset(header.base, ExtractBits(words, i, header.width));
+        }
+    }
+
+    SimpleVector<BlockHeader> headers_;
+    SimpleVector<uint64_t> words_;
+    SimpleVector<IntType> tail_;
+};
+
+template <typename IntType>
+inline bool operator==(const CompressedVector<IntType>& lhs, const CompressedVector<IntType>& rhs) {
+    return &lhs == &rhs || std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename IntType>
+inline bool operator!=(const CompressedVector<IntType>& lhs, const CompressedVector<IntType>& rhs) {
+    return !(lhs == rhs);
+}
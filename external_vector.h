@@ -0,0 +1,369 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "indexed_iterator.h"
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+//  ExternalVector
+struct ExternalVectorOptions {
+    //       
+    size_t ram_budget_bytes = size_t{ 64 } << 20;
+    //  ,       
+    size_t block_bytes = size_t{ 64 } << 10;
+    //        
+    size_t read_ahead_blocks = 4;
+    //    
+    std::filesystem::path directory = std::filesystem::temp_directory_path();
+};
+
+//     
+struct ExternalVectorStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t blocks_read = 0;
+    size_t blocks_written = 0;
+    //      ;     blocks_read
+    size_t file_reads = 0;
+};
+
+// ,      .
+//      ;     
+// ram_budget_bytes / block_bytes ,   LRU.  
+//     .      ,  
+//        read_ahead_blocks .
+//
+//    operator[]    Set,    
+//         .
+// ,  operator[],       :
+//     .     .
+//     
+template <typename Type>
+class ExternalVector {
+    static_assert(std::is_trivially_copyable_v<Type>, "ExternalVector stores raw bytes of elements on disk");
+
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    //      .      LRU
+    struct Frame {
+        ArrayPtr<Type> data;
+        size_t block = NONE;
+        bool dirty = false;
+        size_t prev = NONE;
+        size_t next = NONE;
+    };
+
+public:
+    using ConstIterator = IndexedIterator<const ExternalVector, const Type, Type>;
+    using Iterator = ConstIterator;
+
+    explicit ExternalVector(ExternalVectorOptions options = {})
+        : block_size_(std::max<size_t>(1, options.block_bytes / sizeof(Type)))
+        , max_frames_(std::max<size_t>(2, options.ram_budget_bytes / (block_size_ * sizeof(Type))))
+        , read_ahead_(std::min(options.read_ahead_blocks, max_frames_ - 1))
+        , path_(CreateTempFile(options.directory))
+    {
+        file_.open(path_, std::ios::in | std::ios::out | std::ios::binary);
+        if (!file_) {
+            std::error_code ignored;
+            std::filesystem::remove(path_, ignored);
+            throw std::runtime_error("cannot open " + path_.string());
+        }
+    }
+
+    ExternalVector(const ExternalVector&) = delete;
+    ExternalVector& operator=(const ExternalVector&) = delete;
+
+    ~ExternalVector() {
+        file_.close();
+        std::error_code ignored;
+        std::filesystem::remove(path_, ignored);
+    }
+
+    //     
+    void PushBack(const Type& item) {
+        const size_t block = size_ / block_size_;
+        if (block == block_count_) {
+            ++block_count_;
+            block_frame_.PushBack(NONE);
+            on_disk_.PushBack(false);
+        }
+        Frame& frame = frames_[GetFrame(block)];
+        frame.data[size_ % block_size_] = item;
+        frame.dirty = true;
+        ++size_;
+    }
+
+    // ""   .     
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //        index
+    const Type& operator[](size_t index) const {
+        return frames_[GetFrame(index / block_size_)].data[index % block_size_];
+    }
+
+    //        index
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    //   ;   .
+    //   std::out_of_range,  index >= size
+    void Set(size_t index, const Type& value) {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        Frame& frame = frames_[GetFrame(index / block_size_)];
+        frame.data[index % block_size_] = value;
+        frame.dirty = true;
+    }
+
+    //      
+    void Flush() {
+        for (size_t i = 0; i < frames_.GetSize(); ++i) {
+            WriteBack(frames_[i]);
+        }
+        file_.flush();
+    }
+
+    //   ,     
+    size_t GetCachedBlockLimit() const noexcept {
+        return max_frames_;
+    }
+
+    //      
+    size_t GetBlockSize() const noexcept {
+        return block_size_;
+    }
+
+    const ExternalVectorStats& GetStats() const noexcept {
+        return stats_;
+    }
+
+    void ResetStats() noexcept {
+        stats_ = {};
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    //      .  "x"     ,
+    //            
+    static std::filesystem::path CreateTempFile(const std::filesystem::path& directory) {
+        std::random_device random;
+        for (int attempt = 0; attempt < 100; ++attempt) {
+            const uint64_t id = (uint64_t{ random() } << 32) ^ random();
+            std::filesystem::path path = directory / ("external_vector_" + std::to_string(id) + ".bin");
+            if (std::FILE* file = std::fopen(path.string().c_str(), "wbx")) {
+                std::fclose(file);
+                return path;
+            }
+            std::error_code ignored;
+            if (!std::filesystem::exists(path, ignored)) {
+                break;
+            }
+        }
+        throw std::runtime_error("cannot create a temporary file in " + directory.string());
+    }
+
+    //     block,      
+    size_t GetFrame(size_t block) const {
+        //          LRU
+        if (block == last_block_) {
+            ++stats_.hits;
+            return last_frame_;
+        }
+
+        size_t frame = block_frame_[block];
+        if (frame != NONE) {
+            ++stats_.hits;
+            Touch(frame);
+        } else {
+            ++stats_.misses;
+            const bool sequential = last_block_ != NONE && block == last_block_ + 1;
+            frame = Load(block, sequential ? 1 + read_ahead_ : 1);
+        }
+        last_block_ = block;
+        last_frame_ = frame;
+        return frame;
+    }
+
+    //   block     ,    ,     count.
+    //         .
+    //  block        LRU;  
+    //   read_ahead_,    ,      
+    size_t Load(size_t block, size_t count) const {
+        if (!on_disk_[block]) {
+            return AcquireFrame(block);
+        }
+        size_t run = 1;
+        const size_t last = std::min(block_count_, block + count);
+        while (block + run < last && block_frame_[block + run] == NONE && on_disk_[block + run]) {
+            ++run;
+        }
+        if (run == 1) {
+            const size_t frame_index = AcquireFrame(block);
+            ReadBlocks(block, 1, frames_[frame_index].data.Get());
+            return frame_index;
+        }
+
+        if (!read_buffer_) {
+            ArrayPtr<Type> buffer(block_size_ * (1 + read_ahead_));
+            read_buffer_.swap(buffer);
+        }
+        ReadBlocks(block, run, read_buffer_.Get());
+        for (size_t i = 1; i < run; ++i) {
+            Frame& frame = frames_[AcquireFrame(block + i)];
+            std::copy_n(read_buffer_.Get() + i * block_size_, block_size_, frame.data.Get());
+        }
+        const size_t frame_index = AcquireFrame(block);
+        std::copy_n(read_buffer_.Get(), block_size_, frames_[frame_index].data.Get());
+        return frame_index;
+    }
+
+    //  count ,   first,   destination
+    void ReadBlocks(size_t first, size_t count, Type* destination) const {
+        file_.seekg(static_cast<std::streamoff>(first * BlockBytes()));
+        file_.read(reinterpret_cast<char*>(destination), static_cast<std::streamsize>(count * BlockBytes()));
+        if (!file_) {
+            throw std::runtime_error("cannot read " + path_.string());
+        }
+        stats_.blocks_read += count;
+        ++stats_.file_reads;
+    }
+
+    //     block: ,    ,    
+    size_t AcquireFrame(size_t block) const {
+        size_t frame_index;
+        if (frames_.GetSize() < max_frames_) {
+            frame_index = frames_.GetSize();
+            Frame frame;
+            ArrayPtr<Type> data(block_size_);
+            frame.data.swap(data);
+            frames_.PushBack(std::move(frame));
+        } else {
+            frame_index = lru_tail_;
+            Frame& victim = frames_[frame_index];
+            WriteBack(victim);
+            block_frame_[victim.block] = NONE;
+            if (victim.block == last_block_) {
+                last_block_ = NONE;
+            }
+            Unlink(frame_index);
+        }
+        PushFront(frame_index);
+        Frame& frame = frames_[frame_index];
+        frame.block = block;
+        frame.dirty = false;
+        block_frame_[block] = frame_index;
+        return frame_index;
+    }
+
+    void WriteBack(Frame& frame) const {
+        if (!frame.dirty) {
+            return;
+        }
+        file_.seekp(static_cast<std::streamoff>(frame.block * BlockBytes()));
+        file_.write(reinterpret_cast<const char*>(frame.data.Get()), static_cast<std::streamsize>(BlockBytes()));
+        if (!file_) {
+            throw std::runtime_error("cannot write " + path_.string());
+        }
+        on_disk_[frame.block] = true;
+        frame.dirty = false;
+        ++stats_.blocks_written;
+    }
+
+    size_t BlockBytes() const noexcept {
+        return block_size_ * sizeof(Type);
+    }
+
+    void Touch(size_t frame) const noexcept {
+        if (lru_head_ != frame) {
+            Unlink(frame);
+            PushFront(frame);
+        }
+    }
+
+    void Unlink(size_t frame) const noexcept {
+        Frame& node = frames_[frame];
+        (node.prev != NONE ? frames_[node.prev].next : lru_head_) = node.next;
+        (node.next != NONE ? frames_[node.next].prev : lru_tail_) = node.prev;
+        node.prev = node.next = NONE;
+    }
+
+    void PushFront(size_t frame) const noexcept {
+        Frame& node = frames_[frame];
+        node.prev = NONE;
+        node.next = lru_head_;
+        if (lru_head_ != NONE) {
+            frames_[lru_head_].prev = frame;
+        }
+        lru_head_ = frame;
+        if (lru_tail_ == NONE) {
+            lru_tail_ = frame;
+        }
+    }
+
+    const size_t block_size_;
+    const size_t max_frames_;
+    const size_t read_ahead_;
+    const std::filesystem::path path_;
+    size_t size_ = 0;
+    size_t block_count_ = 0;
+
+    //     ,     mutable
+    mutable std::fstream file_;
+    mutable SimpleVector<Frame> frames_;
+    mutable SimpleVector<size_t> block_frame_;
+    mutable SimpleVector<bool> on_disk_;
+    //     1 + read_ahead_ ,    
+    mutable ArrayPtr<Type> read_buffer_;
+    mutable size_t lru_head_ = NONE;
+    mutable size_t lru_tail_ = NONE;
+    mutable size_t last_block_ = NONE;
+    mutable size_t last_frame_ = NONE;
+    mutable ExternalVectorStats stats_;
+};
@@ -0,0 +1,285 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "indexed_iterator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+//    (gap buffer).
+//       ,     [gap_begin_, gap_end_),
+//      .     
+//     ()  O(1) ,
+//   O(n),   SimpleVector::Insert/Erase.
+template <typename Type>
+class GapVector {
+public:
+    using Iterator = IndexedIterator<GapVector, Type>;
+    using ConstIterator = IndexedIterator<const GapVector, const Type>;
+
+    GapVector() noexcept = default;
+
+    //    size ,    
+    explicit GapVector(size_t size)
+        : GapVector(size, Type())
+    {}
+
+    //    size ,   value
+    GapVector(size_t size, const Type& value)
+        : capacity_(size)
+        , gap_begin_(size)
+        , gap_end_(size)
+        , array_(size)
+    {
+        std::fill(array_.Get(), array_.Get() + size, value);
+    }
+
+    //    std::initializer_list
+    GapVector(std::initializer_list<Type> init)
+        : capacity_(init.size())
+        , gap_begin_(init.size())
+        , gap_end_(init.size())
+        , array_(init.size())
+    {
+        std::copy(init.begin(), init.end(), array_.Get());
+    }
+
+    GapVector(const GapVector& other)
+        : capacity_(other.GetSize())
+        , gap_begin_(other.GetSize())
+        , gap_end_(other.GetSize())
+        , array_(other.GetSize())
+    {
+        std::copy(other.begin(), other.end(), array_.Get());
+    }
+
+    GapVector(GapVector&& other) noexcept {
+        swap(other);
+    }
+
+    GapVector& operator=(const GapVector& rhs) {
+        if (this != &rhs) {
+            GapVector tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    GapVector& operator=(GapVector&& rhs) noexcept {
+        if (this != &rhs) {
+            GapVector tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    //     
+    void PushBack(const Type& item) {
+        Insert(cend(), item);
+    }
+
+    void PushBack(Type&& item) {
+        Insert(cend(), std::move(item));
+    }
+
+    //   value   pos.
+    //     .
+    //    pos,        .
+    // value  :     ,     
+    Iterator Insert(ConstIterator pos, const Type& value) {
+        return Insert(pos, Type(value));
+    }
+
+    Iterator Insert(ConstIterator pos, Type&& value) {
+        const size_t npos = pos.GetIndex();
+        PrepareInsert(npos);
+        array_[gap_begin_++] = std::move(value);
+        return Iterator(this, npos);
+    }
+
+    // ""   .     
+    void PopBack() {
+        assert(!IsEmpty());
+        Erase(cend() - 1);
+    }
+
+    //      
+    Iterator Erase(ConstIterator pos) {
+        const size_t npos = pos.GetIndex();
+        assert(npos < GetSize());
+        MoveGap(npos);
+        ++gap_end_;
+        return Iterator(this, npos);
+    }
+
+    //    new_capacity ,   
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            Reallocate(new_capacity);
+        }
+    }
+
+    //     
+    void swap(GapVector& other) noexcept {
+        array_.swap(other.array_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(gap_begin_, other.gap_begin_);
+        std::swap(gap_end_, other.gap_end_);
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return capacity_ - (gap_end_ - gap_begin_);
+    }
+
+    //   
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //   ,   ,      
+    size_t GetGapPosition() const noexcept {
+        return gap_begin_;
+    }
+
+    //       index
+    Type& operator[](size_t index) noexcept {
+        return array_[ToRawIndex(index)];
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        return array_[ToRawIndex(index)];
+    }
+
+    //       index
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= GetSize()) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    //   ,    
+    void Clear() noexcept {
+        gap_begin_ = 0;
+        gap_end_ = capacity_;
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, GetSize());
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, GetSize());
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    size_t ToRawIndex(size_t index) const noexcept {
+        return index < gap_begin_ ? index : index + (gap_end_ - gap_begin_);
+    }
+
+    //   ,        pos
+    void MoveGap(size_t pos) {
+        if (pos < gap_begin_) {
+            //  [pos, gap_begin_)    
+            std::move_backward(array_.Get() + pos, array_.Get() + gap_begin_, array_.Get() + gap_end_);
+            gap_end_ -= gap_begin_ - pos;
+            gap_begin_ = pos;
+        } else if (pos > gap_begin_) {
+            //       
+            const size_t count = pos - gap_begin_;
+            std::move(array_.Get() + gap_end_, array_.Get() + gap_end_ + count, array_.Get() + gap_begin_);
+            gap_begin_ = pos;
+            gap_end_ += count;
+        }
+    }
+
+    void PrepareInsert(size_t pos) {
+        assert(pos <= GetSize());
+        MoveGap(pos);
+        if (gap_begin_ == gap_end_) {
+            Reallocate(capacity_ > 0 ? 2 * capacity_ : 1);
+        }
+    }
+
+    //     ;    ,    
+    void Reallocate(size_t new_capacity) {
+        ArrayPtr<Type> tmp(new_capacity);
+        const size_t tail_size = capacity_ - gap_end_;
+        const size_t new_gap_end = new_capacity - tail_size;
+        std::move(array_.Get(), array_.Get() + gap_begin_, tmp.Get());
+        std::move(array_.Get() + gap_end_, array_.Get() + capacity_, tmp.Get() + new_gap_end);
+        array_.swap(tmp);
+        capacity_ = new_capacity;
+        gap_end_ = new_gap_end;
+    }
+
+    size_t capacity_ = 0;
+    size_t gap_begin_ = 0;
+    size_t gap_end_ = 0;
+    ArrayPtr<Type> array_;
+};
+
+template <typename Type>
+inline bool operator==(const GapVector<Type>& lhs, const GapVector<Type>& rhs) {
+    return &lhs == &rhs || std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+inline bool operator!=(const GapVector<Type>& lhs, const GapVector<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type>
+inline bool operator<(const GapVector<Type>& lhs, const GapVector<Type>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+inline bool operator<=(const GapVector<Type>& lhs, const GapVector<Type>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type>
+inline bool operator>(const GapVector<Type>& lhs, const GapVector<Type>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type>
+inline bool operator>=(const GapVector<Type>& lhs, const GapVector<Type>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,318 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+//  SimpleVector.
+//    Type     (std::has_unique_object_representations:
+// , , ,      ),  
+//      wyhash: 48     
+//  64x64->128,   .    (float, std::string, ...)
+//   std::hash<Type>   .
+// HashedVector   ,       
+
+namespace hash_detail {
+
+constexpr uint64_t SECRET[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+//  128- :    a,   b
+inline void Multiply(uint64_t& a, uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    a = static_cast<uint64_t>(product);
+    b = static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    a = _umul128(a, b, &b);
+#else
+    const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+    const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+    uint64_t carry = t < rl;
+    const uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    const uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    a = lo;
+    b = hi;
+#endif
+}
+
+inline uint64_t Mix(uint64_t a, uint64_t b) noexcept {
+    Multiply(a, b);
+    return a ^ b;
+}
+
+inline uint64_t Read8(const unsigned char* p) noexcept {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t Read4(const unsigned char* p) noexcept {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+//  1-3 
+inline uint64_t Read3(const unsigned char* p, size_t k) noexcept {
+    return (uint64_t{ p[0] } << 16) | (uint64_t{ p[k >> 1] } << 8) | p[k - 1];
+}
+
+}  // namespace hash_detail
+
+//  size ,   data (wyhash)
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0) noexcept {
+    using namespace hash_detail;
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    seed ^= Mix(seed ^ SECRET[0], SECRET[1]);
+    uint64_t a;
+    uint64_t b;
+    if (size <= 16) {
+        if (size >= 4) {
+            //     4..16   
+            a = (Read4(p) << 32) | Read4(p + ((size >> 3) << 2));
+            b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - ((size >> 3) << 2));
+        } else if (size > 0) {
+            a = Read3(p, size);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t rest = size;
+        if (rest > 48) {
+            //       
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do {
+                seed = Mix(Read8(p) ^ SECRET[1], Read8(p + 8) ^ seed);
+                seed1 = Mix(Read8(p + 16) ^ SECRET[2], Read8(p + 24) ^ seed1);
+                seed2 = Mix(Read8(p + 32) ^ SECRET[3], Read8(p + 40) ^ seed2);
+                p += 48;
+                rest -= 48;
+            } while (rest > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (rest > 16) {
+            seed = Mix(Read8(p) ^ SECRET[1], Read8(p + 8) ^ seed);
+            p += 16;
+            rest -= 16;
+        }
+        a = Read8(p + rest - 16);
+        b = Read8(p + rest - 8);
+    }
+    a ^= SECRET[1];
+    b ^= seed;
+    Multiply(a, b);
+    return Mix(a ^ SECRET[0] ^ size, b ^ SECRET[1]);
+}
+
+//   [first, first + count)
+template <typename Type>
+size_t HashElements(const Type* first, size_t count) {
+    if constexpr (std::has_unique_object_representations_v<Type>) {
+        return static_cast<size_t>(HashBytes(first, count * sizeof(Type)));
+    } else {
+        uint64_t seed = hash_detail::Mix(count ^ hash_detail::SECRET[0], hash_detail::SECRET[1]);
+        const std::hash<Type> hasher;
+        for (size_t i = 0; i < count; ++i) {
+            seed = hash_detail::Mix(seed ^ static_cast<uint64_t>(hasher(first[i])), hash_detail::SECRET[1]);
+        }
+        return static_cast<size_t>(seed);
+    }
+}
+
+namespace std {
+
+template <typename Type>
+struct hash<SimpleVector<Type>> {
+    size_t operator()(const SimpleVector<Type>& vector) const {
+        return HashElements(vector.begin(), vector.GetSize());
+    }
+};
+
+}  // namespace std
+
+// SimpleVector        .
+//            .
+//   ,   ,    GetHash:
+//       
+template <typename Type>
+class HashedVector {
+public:
+    using Iterator = typename SimpleVector<Type>::Iterator;
+    using ConstIterator = typename SimpleVector<Type>::ConstIterator;
+
+    HashedVector() noexcept = default;
+
+    explicit HashedVector(SimpleVector<Type> vector) noexcept
+        : vector_(std::move(vector))
+    {}
+
+    HashedVector(std::initializer_list<Type> init)
+        : vector_(init)
+    {}
+
+    //   ,     
+    size_t GetHash() const {
+        if (!has_hash_) {
+            hash_ = std::hash<SimpleVector<Type>>{}(vector_);
+            has_hash_ = true;
+        }
+        return hash_;
+    }
+
+    // ,   
+    bool HasCachedHash() const noexcept {
+        return has_hash_;
+    }
+
+    const SimpleVector<Type>& GetVector() const noexcept {
+        return vector_;
+    }
+
+    //  ,  HashedVector 
+    SimpleVector<Type> TakeVector() noexcept {
+        Invalidate();
+        return std::move(vector_);
+    }
+
+    //    func   ;  
+    template <typename Func>
+    void Modify(Func func) {
+        Invalidate();
+        func(vector_);
+    }
+
+    size_t GetSize() const noexcept {
+        return vector_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return vector_.IsEmpty();
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        return vector_[index];
+    }
+
+    //    
+    Type& operator[](size_t index) noexcept {
+        Invalidate();
+        return vector_[index];
+    }
+
+    const Type& At(size_t index) const {
+        return vector_.At(index);
+    }
+
+    Type& At(size_t index) {
+        Type& result = vector_.At(index);
+        Invalidate();
+        return result;
+    }
+
+    void PushBack(const Type& item) {
+        vector_.PushBack(item);
+        Invalidate();
+    }
+
+    void PushBack(Type&& item) {
+        vector_.PushBack(std::move(item));
+        Invalidate();
+    }
+
+    void PopBack() noexcept {
+        vector_.PopBack();
+        Invalidate();
+    }
+
+    void Resize(size_t new_size) {
+        vector_.Resize(new_size);
+        Invalidate();
+    }
+
+    void Clear() noexcept {
+        vector_.Clear();
+        Invalidate();
+    }
+
+    void swap(HashedVector& other) noexcept {
+        vector_.swap(other.vector_);
+        std::swap(hash_, other.hash_);
+        std::swap(has_hash_, other.has_hash_);
+    }
+
+    Iterator begin() noexcept {
+        Invalidate();
+        return vector_.begin();
+    }
+
+    Iterator end() noexcept {
+        Invalidate();
+        return vector_.end();
+    }
+
+    ConstIterator begin() const noexcept {
+        return vector_.begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return vector_.end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return vector_.cbegin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return vector_.cend();
+    }
+
+private:
+    void Invalidate() noexcept {
+        has_hash_ = false;
+    }
+
+    SimpleVector<Type> vector_;
+    mutable size_t hash_ = 0;
+    mutable bool has_hash_ = false;
+};
+
+//         
+template <typename Type>
+inline bool operator==(const HashedVector<Type>& lhs, const HashedVector<Type>& rhs) {
+    if (&lhs == &rhs) {
+        return true;
+    }
+    if (lhs.HasCachedHash() && rhs.HasCachedHash() && lhs.GetHash() != rhs.GetHash()) {
+        return false;
+    }
+    return lhs.GetVector() == rhs.GetVector();
+}
+
+template <typename Type>
+inline bool operator!=(const HashedVector<Type>& lhs, const HashedVector<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+namespace std {
+
+template <typename Type>
+struct hash<HashedVector<Type>> {
+    size_t operator()(const HashedVector<Type>& vector) const {
+        return vector.GetHash();
+    }
+};
+
+}  // namespace std
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "indexed_iterator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+//     .
+//  SimpleVector , PushBack         ,
+//          .
+// IncrementalVector       ,    
+//  migrate_per_operation     PushBack/PopBack.   ,
+//  [migrated_, old_size_)    ,    .
+//  ,    ,    ,
+//      O(migrate_per_operation)   
+template <typename Type>
+class IncrementalVector {
+public:
+    using Iterator = IndexedIterator<IncrementalVector, Type>;
+    using ConstIterator = IndexedIterator<const IncrementalVector, const Type>;
+
+    // migrate_per_operation         (  1)
+    explicit IncrementalVector(size_t migrate_per_operation = 64) noexcept
+        : migrate_per_operation_(std::max<size_t>(1, migrate_per_operation))
+    {}
+
+    IncrementalVector(const IncrementalVector&) = delete;
+    IncrementalVector& operator=(const IncrementalVector&) = delete;
+
+    IncrementalVector(IncrementalVector&& other) noexcept {
+        swap(other);
+    }
+
+    IncrementalVector& operator=(IncrementalVector&& rhs) noexcept {
+        if (this != &rhs) {
+            IncrementalVector tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    //     .
+    //       ,       
+    void PushBack(const Type& item) {
+        // item     ,  FinishMigration  MigrateStep
+        //   ,      
+        PushBack(Type(item));
+    }
+
+    void PushBack(Type&& item) {
+        array_[PrepareBack()] = std::move(item);
+        ++size_;
+        MigrateStep();
+    }
+
+    // ""   .     
+    void PopBack() {
+        assert(size_ > 0);
+        --size_;
+        //          
+        old_size_ = std::min(old_size_, std::max(size_, migrated_));
+        MigrateStep();
+    }
+
+    //    new_capacity .   
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            FinishMigration();
+            ArrayPtr<Type> tmp(new_capacity);
+            std::move(array_.Get(), array_.Get() + size_, tmp.Get());
+            array_.swap(tmp);
+            capacity_ = new_capacity;
+        }
+    }
+
+    //         
+    void FinishMigration() {
+        if (IsMigrating()) {
+            std::move(old_array_.Get() + migrated_, old_array_.Get() + old_size_, array_.Get() + migrated_);
+            ReleaseOldArray();
+        }
+    }
+
+    // ,       
+    bool IsMigrating() const noexcept {
+        return static_cast<bool>(old_array_);
+    }
+
+    //     
+    void swap(IncrementalVector& other) noexcept {
+        array_.swap(other.array_);
+        old_array_.swap(other.old_array_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(old_size_, other.old_size_);
+        std::swap(migrated_, other.migrated_);
+        std::swap(migrate_per_operation_, other.migrate_per_operation_);
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //   
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //   ,    
+    void Clear() noexcept {
+        ReleaseOldArray();
+        size_ = 0;
+    }
+
+    //       index
+    Type& operator[](size_t index) noexcept {
+        return IsInOldArray(index) ? old_array_[index] : array_[index];
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        return IsInOldArray(index) ? old_array_[index] : array_[index];
+    }
+
+    //       index
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    //  migrated_ <= index < old_size_   
+    bool IsInOldArray(size_t index) const noexcept {
+        return index - migrated_ < old_size_ - migrated_;
+    }
+
+    //      ,    
+    size_t PrepareBack() {
+        if (size_ == capacity_) {
+            //  ,     ;   PopBack 
+            FinishMigration();
+            const size_t new_capacity = capacity_ > 0 ? 2 * capacity_ : 1;
+            ArrayPtr<Type> tmp(new_capacity);
+            old_array_.swap(array_);
+            array_.swap(tmp);
+            capacity_ = new_capacity;
+            old_size_ = size_;
+            migrated_ = 0;
+        }
+        return size_;
+    }
+
+    void MigrateStep() {
+        if (!IsMigrating()) {
+            return;
+        }
+        const size_t last = std::min(old_size_, migrated_ + migrate_per_operation_);
+        std::move(old_array_.Get() + migrated_, old_array_.Get() + last, array_.Get() + migrated_);
+        migrated_ = last;
+        if (migrated_ == old_size_) {
+            ReleaseOldArray();
+        }
+    }
+
+    void ReleaseOldArray() noexcept {
+        old_array_ = ArrayPtr<Type>();
+        old_size_ = 0;
+        migrated_ = 0;
+    }
+
+    ArrayPtr<Type> array_;
+    ArrayPtr<Type> old_array_;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    //   ,  [migrated_, old_size_)   old_array_
+    size_t old_size_ = 0;
+    size_t migrated_ = 0;
+    size_t migrate_per_operation_ = 64;
+};
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+//     ,     
+//   (GapVector, RingVector).      ,
+//      Owner::operator[].
+//  operator[]  ,    (CompressedVector),
+//   Reference    
+template <typename Owner, typename ValueType, typename Reference = ValueType&>
+class IndexedIterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<ValueType>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType*;
+    using reference = Reference;
+
+    IndexedIterator() = default;
+
+    IndexedIterator(Owner* owner, size_t index) noexcept
+        : owner_(owner)
+        , index_(index)
+    {}
+
+    //     
+    template <typename OtherOwner, typename OtherValueType, typename OtherReference,
+              typename = std::enable_if_t<!std::is_same_v<OtherOwner, Owner> && std::is_convertible_v<OtherOwner*, Owner*>>>
+    IndexedIterator(const IndexedIterator<OtherOwner, OtherValueType, OtherReference>& other) noexcept
+        : owner_(other.GetOwner())
+        , index_(other.GetIndex())
+    {}
+
+    //     
+    size_t GetIndex() const noexcept {
+        return index_;
+    }
+
+    Owner* GetOwner() const noexcept {
+        return owner_;
+    }
+
+    reference operator*() const noexcept {
+        return (*owner_)[index_];
+    }
+
+    pointer operator->() const noexcept {
+        return &(*owner_)[index_];
+    }
+
+    reference operator[](difference_type offset) const noexcept {
+        return (*owner_)[index_ + offset];
+    }
+
+    IndexedIterator& operator++() noexcept {
+        ++index_;
+        return *this;
+    }
+
+    IndexedIterator operator++(int) noexcept {
+        auto old_value(*this);
+        ++index_;
+        return old_value;
+    }
+
+    IndexedIterator& operator--() noexcept {
+        --index_;
+        return *this;
+    }
+
+    IndexedIterator operator--(int) noexcept {
+        auto old_value(*this);
+        --index_;
+        return old_value;
+    }
+
+    IndexedIterator& operator+=(difference_type offset) noexcept {
+        index_ += offset;
+        return *this;
+    }
+
+    IndexedIterator& operator-=(difference_type offset) noexcept {
+        index_ -= offset;
+        return *this;
+    }
+
+    friend IndexedIterator operator+(IndexedIterator it, difference_type offset) noexcept {
+        return it += offset;
+    }
+
+    friend IndexedIterator operator+(difference_type offset, IndexedIterator it) noexcept {
+        return it += offset;
+    }
+
+    friend IndexedIterator operator-(IndexedIterator it, difference_type offset) noexcept {
+        return it -= offset;
+    }
+
+    friend difference_type operator-(const IndexedIterator& lhs, const IndexedIterator& rhs) noexcept {
+        return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+
+    friend bool operator==(const IndexedIterator& lhs, const IndexedIterator& rhs) noexcept {
+        return lhs.index_ == rhs.index_;
+    }
+
+    friend bool operator!=(const IndexedIterator& lhs, const IndexedIterator& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const IndexedIterator& lhs, const IndexedIterator& rhs) noexcept {
+        return lhs.index_ < rhs.index_;
+    }
+
+    friend bool operator>(const IndexedIterator& lhs, const IndexedIterator& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const IndexedIterator& lhs, const IndexedIterator& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const IndexedIterator& lhs, const IndexedIterator& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+private:
+    Owner* owner_ = nullptr;
+    size_t index_ = 0;
+};
@@ -1,7 +1,18 @@
 #include "simple_vector.h"
+#include "gap_vector.h"
+#include "ring_vector.h"
+#include "compressed_vector.h"
+#include "snapshot_vector.h"
+#include "radix_sort.h"
+#include "external_vector.h"
+#include "incremental_vector.h"
+#include "vector_expression.h"
+#include "sparse_vector.h"
+#include "hashed_vector.h"
 
 // Tests
 #include "tests.h"
+#include "benchmarks.h"
 
 #include <iostream>
 #include <cassert>
@@ -190,7 +201,129 @@ void TestNoncopiableErase() {
     cout << "Done!" << endl << endl;
 }
 
-int main() {
+//      .
+// NoexceptMove ,     noexcept
+template <bool NoexceptMove>
+class Counted {
+public:
+    inline static size_t copies = 0;
+    inline static size_t moves = 0;
+
+    static void ResetCounters() {
+        copies = 0;
+        moves = 0;
+    }
+
+    Counted() = default;
+    Counted(int value)
+        : value_(value) {
+    }
+    Counted(const Counted& other)
+        : value_(other.value_) {
+        ++copies;
+    }
+    Counted(Counted&& other) noexcept(NoexceptMove)
+        : value_(exchange(other.value_, 0)) {
+        ++moves;
+    }
+    Counted& operator=(const Counted& other) {
+        value_ = other.value_;
+        ++copies;
+        return *this;
+    }
+    Counted& operator=(Counted&& other) noexcept(NoexceptMove) {
+        value_ = exchange(other.value_, 0);
+        ++moves;
+        return *this;
+    }
+    int GetValue() const {
+        return value_;
+    }
+
+private:
+    int value_ = 0;
+};
+
+void TestMoveAssignmentWithoutCopies() {
+    cout << "Test move assignment without copies" << endl;
+    using Item = Counted<true>;
+    SimpleVector<Item> source(Reserve(4));
+    for (int i = 0; i < 4; ++i) {
+        source.PushBack(Item(i));
+    }
+    const Item* const source_begin = source.begin();
+
+    SimpleVector<Item> target(2);
+    Item::ResetCounters();
+    target = move(source);
+    assert(Item::copies == 0 && Item::moves == 0);
+    assert(target.begin() == source_begin);
+    assert(target.GetSize() == 4 && target[3].GetValue() == 3);
+    assert(source.IsEmpty());
+    cout << "Done!" << endl << endl;
+}
+
+void TestGrowthMovesNoexceptElements() {
+    cout << "Test growth moves noexcept elements" << endl;
+    using Item = Counted<true>;
+    SimpleVector<Item> v;
+    Item::ResetCounters();
+    for (int i = 0; i < 100; ++i) {
+        v.PushBack(Item(i));
+    }
+    v.Insert(v.begin() + 50, Item(-1));
+    v.Reserve(1000);
+    v.Resize(2000);
+    assert(Item::copies == 0);
+    assert(v[50].GetValue() == -1 && v[51].GetValue() == 50 && v[100].GetValue() == 99);
+    cout << "Done!" << endl << endl;
+}
+
+void TestGrowthCopiesThrowingMoveElements() {
+    cout << "Test growth copies elements with throwing move" << endl;
+    using Item = Counted<false>;
+    SimpleVector<Item> v(Reserve(1));
+    v.PushBack(Item(1));
+    Item::ResetCounters();
+    v.Reserve(2);
+    //    ,     
+    assert(Item::copies == 1 && Item::moves == 0);
+    assert(v[0].GetValue() == 1);
+    cout << "Done!" << endl << endl;
+}
+
+void TestCopyAssignmentReusesStorage() {
+    cout << "Test copy assignment reuses storage" << endl;
+    using Item = Counted<true>;
+    SimpleVector<Item> source(3);
+    SimpleVector<Item> target(Reserve(10));
+    const Item* const target_begin = target.begin();
+
+    Item::ResetCounters();
+    target = source;
+    assert(Item::copies == 3 && Item::moves == 0);
+    assert(target.begin() == target_begin);
+    assert(target.GetCapacity() == 10 && target.GetSize() == 3);
+
+    SimpleVector<int> small{ 1, 2 };
+    SimpleVector<int> large{ 1, 2, 3, 4, 5 };
+    small = large;
+    assert(small == large);
+    cout << "Done!" << endl << endl;
+}
+
+void TestPushBackOwnElementAtFullCapacity() {
+    cout << "Test push back own element at full capacity" << endl;
+    const string long_value(40, 'x');
+    SimpleVector<string> v{ long_value, "b"s };
+    assert(v.GetSize() == v.GetCapacity());
+    v.PushBack(v[0]);
+    assert(v.GetSize() == 3);
+    assert(v[0] == long_value && v[2] == long_value);
+    cout << "Done!" << endl << endl;
+}
+
+int main(int argc, char* argv[]) {
     Test1();
     Test2();
 
@@ -205,6 +338,38 @@ int main() {
     TestNoncopiablePushBack();
     TestNoncopiableInsert();
     TestNoncopiableErase();
+    TestMoveAssignmentWithoutCopies();
+    TestGrowthMovesNoexceptElements();
+    TestGrowthCopiesThrowingMoveElements();
+    TestCopyAssignmentReusesStorage();
+    TestPushBackOwnElementAtFullCapacity();
+
+    TestGapVector();
+    TestRingVector();
+    TestCompressedVector();
+    TestSnapshotVector();
+    TestRadixSort();
+    TestExternalVector();
+    TestIncrementalVector();
+    TestBufferPool();
+    TestVectorExpression();
+    TestSparseVector();
+    TestHashedVector();
+
+    //    : simplevector --bench
+    if (argc > 1 && argv[1] == "--bench"s) {
+        BenchmarkGapVector();
+        BenchmarkRingVector();
+        BenchmarkCompressedVector();
+        BenchmarkSnapshotVector();
+        BenchmarkRadixSort();
+        BenchmarkExternalVector();
+        BenchmarkIncrementalVector();
+        BenchmarkBufferPool();
+        BenchmarkVectorExpression();
+        BenchmarkSparseVector();
+        BenchmarkHashedVector();
+    }
 
     return 0;
 }
@@ -0,0 +1,316 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//   SimpleVector        .
+//             :
+// LSD (RadixSort, RadixSortBy, RadixSortPairs, ParallelRadixSort)    
+//  , ,     ; MSD (MsdRadixSort)   
+// ,  ,   .
+//  scratch   ,       
+
+namespace radix_detail {
+
+//     ,      
+template <typename Key, typename = void>
+struct KeyBits;
+
+template <typename Key>
+struct KeyBits<Key, std::enable_if_t<std::is_integral_v<Key>>> {
+    using Bits = std::make_unsigned_t<Key>;
+
+    static Bits Get(Key key) noexcept {
+        Bits bits = static_cast<Bits>(key);
+        if constexpr (std::is_signed_v<Key>) {
+            //      
+            bits ^= Bits{ 1 } << (sizeof(Key) * 8 - 1);
+        }
+        return bits;
+    }
+};
+
+template <typename Key>
+struct KeyBits<Key, std::enable_if_t<std::is_floating_point_v<Key>>> {
+    static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "only float and double are supported");
+    using Bits = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+
+    //      ,     
+    static Bits Get(Key key) noexcept {
+        Bits bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        const Bits sign = Bits{ 1 } << (sizeof(Bits) * 8 - 1);
+        return (bits & sign) != 0 ? ~bits : bits | sign;
+    }
+};
+
+constexpr size_t DIGIT_BITS = 8;
+constexpr size_t DIGIT_COUNT = size_t{ 1 } << DIGIT_BITS;
+
+template <typename Bits>
+size_t Digit(Bits bits, size_t pass) noexcept {
+    return static_cast<size_t>(bits >> (pass * DIGIT_BITS)) & (DIGIT_COUNT - 1);
+}
+
+//     ,    
+struct NoValues {};
+
+template <typename Type>
+void PrepareScratch(SimpleVector<Type>& scratch, size_t size) {
+    if (scratch.GetSize() < size) {
+        scratch = SimpleVector<Type>(size);
+    }
+}
+
+// LSD-  records   key_of(record); values,  ,
+//    .       ,
+// ,       , 
+template <typename Record, typename KeyOf, typename Value = NoValues>
+void LsdSort(Record* records, Record* record_scratch, size_t size, KeyOf key_of,
+             Value* values = nullptr, Value* value_scratch = nullptr) {
+    using Traits = KeyBits<std::decay_t<decltype(key_of(*records))>>;
+    using Bits = typename Traits::Bits;
+    constexpr size_t pass_count = sizeof(Bits);
+    constexpr bool has_values = !std::is_same_v<Value, NoValues>;
+
+    if (size < 2) {
+        return;
+    }
+
+    std::vector<size_t> counts(pass_count * DIGIT_COUNT, 0);
+    for (size_t i = 0; i < size; ++i) {
+        const Bits bits = Traits::Get(key_of(records[i]));
+        for (size_t pass = 0; pass < pass_count; ++pass) {
+            ++counts[pass * DIGIT_COUNT + Digit(bits, pass)];
+        }
+    }
+
+    Record* src = records;
+    Record* dst = record_scratch;
+    Value* src_values = values;
+    Value* dst_values = value_scratch;
+    for (size_t pass = 0; pass < pass_count; ++pass) {
+        size_t* offsets = counts.data() + pass * DIGIT_COUNT;
+        if (offsets[Digit(Traits::Get(key_of(src[0])), pass)] == size) {
+            continue;
+        }
+        size_t total = 0;
+        for (size_t digit = 0; digit < DIGIT_COUNT; ++digit) {
+            total += std::exchange(offsets[digit], total);
+        }
+        for (size_t i = 0; i < size; ++i) {
+            const size_t pos = offsets[Digit(Traits::Get(key_of(src[i])), pass)]++;
+            dst[pos] = std::move(src[i]);
+            if constexpr (has_values) {
+                dst_values[pos] = std::move(src_values[i]);
+            }
+        }
+        std::swap(src, dst);
+        if constexpr (has_values) {
+            std::swap(src_values, dst_values);
+        }
+    }
+
+    if (src != records) {
+        std::move(src, src + size, records);
+        if constexpr (has_values) {
+            std::move(src_values, src_values + size, values);
+        }
+    }
+}
+
+// MSD-   (American flag sort).    std::sort
+template <typename Key>
+void MsdSort(Key* keys, size_t size, size_t pass) {
+    using Traits = KeyBits<Key>;
+    constexpr size_t small_size = 64;
+
+    if (size <= small_size) {
+        std::sort(keys, keys + size, [](const Key& lhs, const Key& rhs) {
+            return Traits::Get(lhs) < Traits::Get(rhs);
+        });
+        return;
+    }
+
+    size_t counts[DIGIT_COUNT] = {};
+    for (size_t i = 0; i < size; ++i) {
+        ++counts[Digit(Traits::Get(keys[i]), pass)];
+    }
+    size_t starts[DIGIT_COUNT];
+    size_t ends[DIGIT_COUNT];
+    size_t total = 0;
+    for (size_t digit = 0; digit < DIGIT_COUNT; ++digit) {
+        starts[digit] = total;
+        total += counts[digit];
+        ends[digit] = total;
+    }
+
+    //      ,      ,
+    //          
+    size_t next[DIGIT_COUNT];
+    std::copy(starts, starts + DIGIT_COUNT, next);
+    for (size_t digit = 0; digit < DIGIT_COUNT; ++digit) {
+        while (next[digit] < ends[digit]) {
+            const size_t target = Digit(Traits::Get(keys[next[digit]]), pass);
+            if (target == digit) {
+                ++next[digit];
+            } else {
+                std::swap(keys[next[digit]], keys[next[target]++]);
+            }
+        }
+    }
+
+    if (pass == 0) {
+        return;
+    }
+    for (size_t digit = 0; digit < DIGIT_COUNT; ++digit) {
+        if (counts[digit] > 1) {
+            MsdSort(keys + starts[digit], counts[digit], pass - 1);
+        }
+    }
+}
+
+}  // namespace radix_detail
+
+//      (LSD, )
+template <typename Key>
+void RadixSort(SimpleVector<Key>& keys, SimpleVector<Key>& scratch) {
+    radix_detail::PrepareScratch(scratch, keys.GetSize());
+    radix_detail::LsdSort(keys.begin(), scratch.begin(), keys.GetSize(), [](const Key& key) {
+        return key;
+    });
+}
+
+template <typename Key>
+void RadixSort(SimpleVector<Key>& keys) {
+    SimpleVector<Key> scratch;
+    RadixSort(keys, scratch);
+}
+
+//       key_of(record)
+template <typename Record, typename KeyOf>
+void RadixSortBy(SimpleVector<Record>& records, KeyOf key_of, SimpleVector<Record>& scratch) {
+    radix_detail::PrepareScratch(scratch, records.GetSize());
+    radix_detail::LsdSort(records.begin(), scratch.begin(), records.GetSize(), key_of);
+}
+
+template <typename Record, typename KeyOf>
+void RadixSortBy(SimpleVector<Record>& records, KeyOf key_of) {
+    SimpleVector<Record> scratch;
+    RadixSortBy(records, key_of, scratch);
+}
+
+//    (keys[i], values[i])  .     .
+// , values     
+template <typename Key, typename Value>
+void RadixSortPairs(SimpleVector<Key>& keys, SimpleVector<Value>& values,
+                    SimpleVector<Key>& key_scratch, SimpleVector<Value>& value_scratch) {
+    assert(keys.GetSize() == values.GetSize());
+    radix_detail::PrepareScratch(key_scratch, keys.GetSize());
+    radix_detail::PrepareScratch(value_scratch, values.GetSize());
+    radix_detail::LsdSort(keys.begin(), key_scratch.begin(), keys.GetSize(), [](const Key& key) {
+        return key;
+    }, values.begin(), value_scratch.begin());
+}
+
+template <typename Key, typename Value>
+void RadixSortPairs(SimpleVector<Key>& keys, SimpleVector<Value>& values) {
+    SimpleVector<Key> key_scratch;
+    SimpleVector<Value> value_scratch;
+    RadixSortPairs(keys, values, key_scratch, value_scratch);
+}
+
+//        (MSD, )
+template <typename Key>
+void MsdRadixSort(SimpleVector<Key>& keys) {
+    radix_detail::MsdSort(keys.begin(), keys.GetSize(), sizeof(typename radix_detail::KeyBits<Key>::Bits) - 1);
+}
+
+//  LSD-.      ,
+//      ,     .
+// thread_count == 0  std::thread::hardware_concurrency()
+template <typename Key>
+void ParallelRadixSort(SimpleVector<Key>& keys, SimpleVector<Key>& scratch, size_t thread_count = 0) {
+    using namespace radix_detail;
+    using Traits = KeyBits<Key>;
+    using Bits = typename Traits::Bits;
+
+    const size_t size = keys.GetSize();
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    //      
+    thread_count = std::min(thread_count, std::max<size_t>(1, size / 65536));
+    if (thread_count == 1) {
+        RadixSort(keys, scratch);
+        return;
+    }
+    PrepareScratch(scratch, size);
+
+    const size_t chunk = (size + thread_count - 1) / thread_count;
+    auto run_parallel = [&](auto work) {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back(work, t, std::min(size, t * chunk), std::min(size, (t + 1) * chunk));
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+
+    Key* src = keys.begin();
+    Key* dst = scratch.begin();
+    std::vector<size_t> offsets(thread_count * DIGIT_COUNT);
+    for (size_t pass = 0; pass < sizeof(Bits); ++pass) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        run_parallel([&](size_t t, size_t first, size_t last) {
+            size_t* counts = offsets.data() + t * DIGIT_COUNT;
+            for (size_t i = first; i < last; ++i) {
+                ++counts[Digit(Traits::Get(src[i]), pass)];
+            }
+        });
+
+        const size_t first_digit = Digit(Traits::Get(src[0]), pass);
+        size_t first_digit_count = 0;
+        for (size_t t = 0; t < thread_count; ++t) {
+            first_digit_count += offsets[t * DIGIT_COUNT + first_digit];
+        }
+        if (first_digit_count == size) {
+            continue;
+        }
+
+        //    d   t         d   0..t-1
+        size_t total = 0;
+        for (size_t digit = 0; digit < DIGIT_COUNT; ++digit) {
+            for (size_t t = 0; t < thread_count; ++t) {
+                total += std::exchange(offsets[t * DIGIT_COUNT + digit], total);
+            }
+        }
+        run_parallel([&](size_t t, size_t first, size_t last) {
+            size_t* positions = offsets.data() + t * DIGIT_COUNT;
+            for (size_t i = first; i < last; ++i) {
+                dst[positions[Digit(Traits::Get(src[i]), pass)]++] = std::move(src[i]);
+            }
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != keys.begin()) {
+        std::move(src, src + size, keys.begin());
+    }
+}
+
+template <typename Key>
+void ParallelRadixSort(SimpleVector<Key>& keys, size_t thread_count = 0) {
+    SimpleVector<Key> scratch;
+    ParallelRadixSort(keys, scratch, thread_count);
+}
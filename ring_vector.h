@@ -0,0 +1,355 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "indexed_iterator.h"
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+//  RingVector     
+enum class RingOverflow {
+    Grow,       //   ,  SimpleVector
+    Overwrite,  //  ,     
+};
+
+//     
+template <typename Type>
+struct RingSegment {
+    Type* data = nullptr;
+    size_t size = 0;
+
+    Type* begin() const noexcept {
+        return data;
+    }
+
+    Type* end() const noexcept {
+        return data + size;
+    }
+};
+
+//     .
+//        O(1),     .
+//        , . GetSegments
+template <typename Type>
+class RingVector {
+public:
+    using Iterator = IndexedIterator<RingVector, Type>;
+    using ConstIterator = IndexedIterator<const RingVector, const Type>;
+    using Segments = std::pair<RingSegment<Type>, RingSegment<Type>>;
+    using ConstSegments = std::pair<RingSegment<const Type>, RingSegment<const Type>>;
+
+    RingVector() noexcept = default;
+
+    //    size ,    
+    explicit RingVector(size_t size)
+        : RingVector(size, Type())
+    {}
+
+    //    size ,   value
+    RingVector(size_t size, const Type& value)
+        : capacity_(size)
+        , size_(size)
+        , array_(size)
+    {
+        std::fill(array_.Get(), array_.Get() + size, value);
+    }
+
+    //    std::initializer_list
+    RingVector(std::initializer_list<Type> init)
+        : capacity_(init.size())
+        , size_(init.size())
+        , array_(init.size())
+    {
+        std::copy(init.begin(), init.end(), array_.Get());
+    }
+
+    //     .
+    //   RingOverflow::Overwrite    :
+    // RingVector<int> window(Reserve(1024), RingOverflow::Overwrite);
+    explicit RingVector(ReserveProxyObj reserve, RingOverflow overflow = RingOverflow::Grow)
+        : capacity_(reserve.GetCapacity())
+        , array_(capacity_)
+        , overflow_(overflow)
+    {}
+
+    //       
+    RingVector(const RingVector& other)
+        : capacity_(other.overflow_ == RingOverflow::Overwrite ? other.capacity_ : other.size_)
+        , size_(other.size_)
+        , array_(capacity_)
+        , overflow_(other.overflow_)
+    {
+        std::copy(other.begin(), other.end(), array_.Get());
+    }
+
+    RingVector(RingVector&& other) noexcept {
+        swap(other);
+    }
+
+    RingVector& operator=(const RingVector& rhs) {
+        if (this != &rhs) {
+            RingVector tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    RingVector& operator=(RingVector&& rhs) noexcept {
+        if (this != &rhs) {
+            RingVector tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    //     .
+    //   Overwrite     .
+    // item  :     ,     PrepareBack
+    void PushBack(const Type& item) {
+        PushBack(Type(item));
+    }
+
+    void PushBack(Type&& item) {
+        array_[PrepareBack()] = std::move(item);
+    }
+
+    //     .
+    //   Overwrite     
+    void PushFront(const Type& item) {
+        PushFront(Type(item));
+    }
+
+    void PushFront(Type&& item) {
+        array_[PrepareFront()] = std::move(item);
+    }
+
+    // ""   .     
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+    }
+
+    // ""   .     
+    void PopFront() noexcept {
+        assert(size_ > 0);
+        head_ = Wrap(head_ + 1);
+        --size_;
+    }
+
+    Type& Front() noexcept {
+        return (*this)[0];
+    }
+
+    const Type& Front() const noexcept {
+        return (*this)[0];
+    }
+
+    Type& Back() noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    const Type& Back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    //    new_capacity .
+    //      
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            Reallocate(new_capacity);
+        }
+    }
+
+    //     
+    void swap(RingVector& other) noexcept {
+        array_.swap(other.array_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+        std::swap(overflow_, other.overflow_);
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //   
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // ,     
+    bool IsFull() const noexcept {
+        return size_ == capacity_;
+    }
+
+    RingOverflow GetOverflow() const noexcept {
+        return overflow_;
+    }
+
+    //       index
+    Type& operator[](size_t index) noexcept {
+        return array_[Wrap(head_ + index)];
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        return array_[Wrap(head_ + index)];
+    }
+
+    //       index
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    //   ,    
+    void Clear() noexcept {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    //       : [head_,  )  [0, ).
+    //   ,       .
+    //    -   
+    Segments GetSegments() noexcept {
+        const size_t first_size = std::min(size_, capacity_ - head_);
+        return { { array_.Get() + head_, first_size }, { array_.Get(), size_ - first_size } };
+    }
+
+    ConstSegments GetSegments() const noexcept {
+        const size_t first_size = std::min(size_, capacity_ - head_);
+        return { { array_.Get() + head_, first_size }, { array_.Get(), size_ - first_size } };
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    //     [0, capacity_).    2 * capacity_,
+    //        
+    size_t Wrap(size_t pos) const noexcept {
+        return pos >= capacity_ ? pos - capacity_ : pos;
+    }
+
+    //        
+    size_t PrepareBack() {
+        if (size_ == capacity_) {
+            if (overflow_ == RingOverflow::Overwrite) {
+                if (capacity_ == 0) {
+                    throw std::length_error("ring capacity");
+                }
+                const size_t pos = head_;
+                head_ = Wrap(head_ + 1);
+                return pos;
+            }
+            Reallocate(capacity_ > 0 ? 2 * capacity_ : 1);
+        }
+        return Wrap(head_ + size_++);
+    }
+
+    //        
+    size_t PrepareFront() {
+        if (size_ == capacity_) {
+            if (overflow_ == RingOverflow::Overwrite) {
+                if (capacity_ == 0) {
+                    throw std::length_error("ring capacity");
+                }
+                head_ = Wrap(head_ + capacity_ - 1);
+                return head_;
+            }
+            Reallocate(capacity_ > 0 ? 2 * capacity_ : 1);
+        }
+        head_ = Wrap(head_ + capacity_ - 1);
+        ++size_;
+        return head_;
+    }
+
+    void Reallocate(size_t new_capacity) {
+        ArrayPtr<Type> tmp(new_capacity);
+        const auto [first, second] = GetSegments();
+        std::move(first.begin(), first.end(), tmp.Get());
+        std::move(second.begin(), second.end(), tmp.Get() + first.size);
+        array_.swap(tmp);
+        capacity_ = new_capacity;
+        head_ = 0;
+    }
+
+    size_t capacity_ = 0;
+    size_t head_ = 0;
+    size_t size_ = 0;
+    ArrayPtr<Type> array_;
+    RingOverflow overflow_ = RingOverflow::Grow;
+};
+
+template <typename Type>
+inline bool operator==(const RingVector<Type>& lhs, const RingVector<Type>& rhs) {
+    return &lhs == &rhs || std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+inline bool operator!=(const RingVector<Type>& lhs, const RingVector<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type>
+inline bool operator<(const RingVector<Type>& lhs, const RingVector<Type>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+inline bool operator<=(const RingVector<Type>& lhs, const RingVector<Type>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type>
+inline bool operator>(const RingVector<Type>& lhs, const RingVector<Type>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type>
+inline bool operator>=(const RingVector<Type>& lhs, const RingVector<Type>& rhs) {
+    return !(lhs < rhs);
+}
@@ -1,12 +1,13 @@
 #pragma once
 
-#include "array_ptr.h"
+#include "buffer_pool.h"
 
 #include <cassert>
 #include <initializer_list>
 #include <algorithm>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
 
 class ReserveProxyObj
 {
@@ -26,6 +27,10 @@ ReserveProxyObj Reserve(size_t capacity_to_reserve) {
     return ReserveProxyObj(capacity_to_reserve);
 };
 
+//    , . vector_expression.h
+template <typename Derived>
+class VectorExpression;
+
 template <typename Type>
 class SimpleVector {
 public:
@@ -37,7 +42,7 @@ public:
     SimpleVector() noexcept
         : capacity_(0)
         , size_(0)
-        , array_(nullptr)
+        , array_()
     {}
 
     //    size ,    
@@ -71,14 +76,23 @@ public:
         std::copy(init.begin(), init.end(), begin());
     }
     
+    //      ,     
+    template <typename Derived>
+    SimpleVector(const VectorExpression<Derived>& expression)
+        : SimpleVector(ReserveProxyObj(expression.GetSize()))
+    {
+        expression.Self().EvaluateInto(array_.Get(), 0, capacity_);
+        size_ = capacity_;
+    }
+
     SimpleVector(const SimpleVector& other) 
         : capacity_(0)
         , size_(0)
-        , array_(nullptr)
+        , array_()
     {
         //    
         if (other.size_ > 0) {
-            ArrayPtr<Type> tmp(other.size_);
+            PooledArrayPtr<Type> tmp(other.size_);
             for (size_t i = 0; i < other.size_; ++i) {
                 tmp[i] = other.array_[i];
             }
@@ -89,34 +103,62 @@ public:
         }
     }
 
-    SimpleVector(SimpleVector&& other) noexcept {
-        // std::cout << "Move " << std::endl;
+    SimpleVector(SimpleVector&& other) noexcept
+        : capacity_(0)
+        , size_(0)
+        , array_()
+    {
         swap(other);
     }
 
+    //    ,       
     SimpleVector& operator=(const SimpleVector& rhs) {
-        //    
-        if(this != &rhs) {
-            SimpleVector tmp(rhs);
+        if (this != &rhs) {
+            if (rhs.size_ <= capacity_) {
+                std::copy(rhs.begin(), rhs.end(), begin());
+                size_ = rhs.size_;
+            } else {
+                SimpleVector tmp(rhs);
+                swap(tmp);
+            }
+        }
+        return *this;
+    }
+
+    //   rhs,      . rhs  
+    SimpleVector& operator=(SimpleVector&& rhs) noexcept {
+        if (this != &rhs) {
+            SimpleVector tmp(std::move(rhs));
             swap(tmp);
         }
         return *this;
     }
 
+    //      .   ,
+    //     ;      
+    template <typename Derived>
+    SimpleVector& operator=(const VectorExpression<Derived>& expression) {
+        const size_t size = expression.GetSize();
+        if (size > capacity_) {
+            PooledArrayPtr<Type> tmp(size);
+            expression.Self().EvaluateInto(tmp.Get(), 0, size);
+            array_.swap(tmp);
+            capacity_ = size;
+        } else {
+            expression.Self().EvaluateInto(array_.Get(), 0, size);
+        }
+        size_ = size;
+        return *this;
+    }
+
     //     
     //       
     void PushBack(const Type& item) {
         //   
         if (size_ == capacity_) {
-            size_t new_capacity = size_ > 0 ? 2 * capacity_ : 1;
-            ArrayPtr<Type> tmp(new_capacity);
-            for (size_t i = 0; i < size_; ++i) {
-                tmp[i] = array_[i];
-            }
-            tmp[size_] = item;
-            array_.swap(tmp);
-            ++size_;
-            capacity_ = new_capacity;
+            // item       ,  Relocate ,
+            //     
+            PushBack(Type(item));
         } else {
             array_[size_++] = item;
         }
@@ -126,10 +168,7 @@ public:
         //   
         if (size_ == capacity_) {
             size_t new_capacity = size_ > 0 ? 2 * capacity_ : 1;
-            ArrayPtr<Type> tmp(new_capacity);
-            for (size_t i = 0; i < size_; ++i) {
-                tmp[i] = std::move(array_[i]);
-            }
+            PooledArrayPtr<Type> tmp = Relocate(new_capacity, size_);
             tmp[size_] = std::move(item);
             array_.swap(tmp);
             ++size_;
@@ -144,54 +183,23 @@ public:
     //     
     //        ,
     //     ,     0   1
+    // value  :     ,    
     Iterator Insert(ConstIterator pos, const Type& value) {
-        size_t npos = pos - begin();
-
-        if (size_ == capacity_) {
-            size_t new_capacity = size_ > 0 ? 2 * capacity_ : 1;
-            ArrayPtr<Type> tmp(new_capacity);
-            for (size_t i = 0; i < npos; ++i) {
-                tmp[i] = array_[i];
-            }
-            tmp[npos] = value;
-            for (size_t i = npos + 1; i < size_ + 1; ++i) {
-                tmp[i] = array_[i - 1];
-            }
-            array_.swap(tmp);
-            ++size_;
-            capacity_ = new_capacity;
-        } else {
-            for (size_t i = npos; i < size_; ++i) {
-                array_[i + 1] = array_[i];
-            }
-            array_[npos] = value;
-            ++size_;
-        }
-
-        return begin() + npos;
+        return Insert(pos, Type(value));
     }
 
-    Iterator Insert(Iterator pos, Type&& value) {
+    Iterator Insert(ConstIterator pos, Type&& value) {
         size_t npos = pos - begin();
 
         if (size_ == capacity_) {
             size_t new_capacity = size_ > 0 ? 2 * capacity_ : 1;
-            ArrayPtr<Type> tmp(new_capacity);
-            for (size_t i = 0; i < npos; ++i) {
-                tmp[i] = std::move(array_[i]);
-            }
+            PooledArrayPtr<Type> tmp = Relocate(new_capacity, npos);
             tmp[npos] = std::move(value);
-            for (size_t i = npos + 1; i < size_ + 1; ++i) {
-                tmp[i] = std::move(array_[i - 1]);
-            }
             array_.swap(tmp);
             ++size_;
             capacity_ = new_capacity;
         } else {
-            for (size_t i = npos; i < size_; ++i) {
-                auto tmp = std::move(array_[i]);
-                array_[i + 1] = std::move(tmp);
-            }
+            std::move_backward(begin() + npos, end(), end() + 1);
             array_[npos] = std::move(value);
             ++size_;
         }
@@ -221,10 +229,7 @@ public:
 
     void Reserve(size_t new_capacity) {
         if (new_capacity > capacity_) {
-            ArrayPtr<Type> tmp(new_capacity);
-            for (size_t i = 0; i < size_; ++i) {
-                tmp[i] = array_[i];
-            }
+            PooledArrayPtr<Type> tmp = Relocate(new_capacity, size_);
             array_.swap(tmp);
             capacity_ = new_capacity;
         }
@@ -309,10 +314,7 @@ public:
             size_ = new_size;
         }
         else {
-            ArrayPtr<Type> new_array(new_size);
-            for (size_t i = 0; i < size_; ++i) {
-                new_array[i] = array_[i];
-            }
+            PooledArrayPtr<Type> new_array = Relocate(new_size, size_);
             for (size_t i = size_; i < new_size; ++i) {
                 new_array[i] = Type();
             }
@@ -358,9 +360,32 @@ public:
         return array_.Get() + size_;
     }
 private:
+    //      ,   
+    //   ,    ,   std::move_if_noexcept
+    static constexpr bool MOVE_ON_RELOCATE = std::is_nothrow_move_assignable_v<Type> || !std::is_copy_assignable_v<Type>;
+
+    static std::conditional_t<MOVE_ON_RELOCATE, Type&&, const Type&> RelocationSource(Type& value) noexcept {
+        return std::move(value);
+    }
+
+    //    new_capacity     ,    gap_pos.
+    //  ,       (  ),
+    //  ,       .
+    //         
+    PooledArrayPtr<Type> Relocate(size_t new_capacity, size_t gap_pos) {
+        PooledArrayPtr<Type> tmp(new_capacity);
+        for (size_t i = 0; i < gap_pos; ++i) {
+            tmp[i] = RelocationSource(array_[i]);
+        }
+        for (size_t i = gap_pos; i < size_; ++i) {
+            tmp[i + 1] = RelocationSource(array_[i]);
+        }
+        return tmp;
+    }
+
     size_t capacity_;
     size_t size_;
-    ArrayPtr<Type> array_;
+    PooledArrayPtr<Type> array_;
 };
 
 template <typename Type>
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "array_ptr.h"
+#include "simple_vector.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+//   ,       (   ..).
+//        :   
+//      .        
+//    .      (epoch-based
+// reclamation):  ,    ,    ,  .
+//
+//  -     RegisterReader    
+template <typename Type>
+class SnapshotVector {
+    struct Version {
+        SimpleVector<Type> data;
+        uint64_t number = 0;
+    };
+
+    //     -,      
+    struct alignas(64) ReaderSlot {
+        // ,      ,  0,    
+        std::atomic<uint64_t> epoch{ 0 };
+        std::atomic<bool> in_use{ false };
+    };
+
+    struct RetiredVersion {
+        Version* version = nullptr;
+        //   ,         
+        uint64_t safe_epoch = 0;
+    };
+
+public:
+    class Reader;
+
+    //   .   ,    
+    class Snapshot {
+    public:
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+        Snapshot(Snapshot&& other) noexcept
+            : reader_(std::exchange(other.reader_, nullptr))
+            , version_(std::exchange(other.version_, nullptr))
+        {}
+
+        ~Snapshot() {
+            if (reader_ != nullptr) {
+                reader_->Release();
+            }
+        }
+
+        //   ;      1
+        uint64_t GetVersion() const noexcept {
+            return version_->number;
+        }
+
+        size_t GetSize() const noexcept {
+            return version_->data.GetSize();
+        }
+
+        bool IsEmpty() const noexcept {
+            return version_->data.IsEmpty();
+        }
+
+        const Type& operator[](size_t index) const noexcept {
+            return version_->data[index];
+        }
+
+        const Type& At(size_t index) const {
+            return version_->data.At(index);
+        }
+
+        const SimpleVector<Type>& GetData() const noexcept {
+            return version_->data;
+        }
+
+        typename SimpleVector<Type>::ConstIterator begin() const noexcept {
+            return version_->data.begin();
+        }
+
+        typename SimpleVector<Type>::ConstIterator end() const noexcept {
+            return version_->data.end();
+        }
+
+    private:
+        friend class Reader;
+
+        Snapshot(const Reader* reader, const Version* version) noexcept
+            : reader_(reader)
+            , version_(version)
+        {}
+
+        const Reader* reader_;
+        const Version* version_;
+    };
+
+    //  -.    .
+    //      ;       
+    class Reader {
+    public:
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        Reader(Reader&& other) noexcept
+            : owner_(other.owner_)
+            , slot_(std::exchange(other.slot_, nullptr))
+        {
+            assert(other.depth_ == 0);
+        }
+
+        ~Reader() {
+            if (slot_ != nullptr) {
+                slot_->in_use.store(false, std::memory_order_release);
+            }
+        }
+
+        //   .      
+        Snapshot Acquire() const noexcept {
+            //       (seq_cst) 
+            //     :     
+            //    ,      .
+            //     ,     
+            if (depth_++ == 0) {
+                slot_->epoch.store(owner_->epoch_.load(), std::memory_order_seq_cst);
+            }
+            return Snapshot(this, owner_->current_.load(std::memory_order_seq_cst));
+        }
+
+    private:
+        friend class SnapshotVector;
+        friend class Snapshot;
+
+        Reader(const SnapshotVector* owner, ReaderSlot* slot) noexcept
+            : owner_(owner)
+            , slot_(slot)
+        {}
+
+        void Release() const noexcept {
+            if (--depth_ == 0) {
+                slot_->epoch.store(0, std::memory_order_release);
+            }
+        }
+
+        const SnapshotVector* owner_;
+        ReaderSlot* slot_;
+        //   ;   -
+        mutable size_t depth_ = 0;
+    };
+
+    //   ,   max_readers   
+    explicit SnapshotVector(size_t max_readers = 64)
+        : slots_(max_readers)
+        , max_readers_(max_readers)
+        , current_(new Version())
+    {}
+
+    explicit SnapshotVector(SimpleVector<Type> data, size_t max_readers = 64)
+        : SnapshotVector(max_readers)
+    {
+        current_.load()->data = std::move(data);
+    }
+
+    SnapshotVector(const SnapshotVector&) = delete;
+    SnapshotVector& operator=(const SnapshotVector&) = delete;
+
+    //       
+    ~SnapshotVector() {
+        delete current_.load();
+        for (const RetiredVersion& retired : retired_) {
+            delete retired.version;
+        }
+    }
+
+    //  -.
+    //  std::length_error,   max_readers  
+    Reader RegisterReader() const {
+        for (size_t i = 0; i < max_readers_; ++i) {
+            bool expected = false;
+            if (slots_[i].in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return Reader(this, &slots_[i]);
+            }
+        }
+        throw std::length_error("too many readers");
+    }
+
+    //        .
+    //       Publish
+    SimpleVector<Type> Edit() const {
+        std::lock_guard guard(write_mutex_);
+        return current_.load()->data;
+    }
+
+    //   . ,   ,   
+    void Publish(SimpleVector<Type> data) {
+        std::lock_guard guard(write_mutex_);
+        PublishLocked(std::move(data));
+    }
+
+    //  mutate         
+    template <typename Mutator>
+    void Update(Mutator mutate) {
+        std::lock_guard guard(write_mutex_);
+        SimpleVector<Type> data(current_.load()->data);
+        mutate(data);
+        PublishLocked(std::move(data));
+    }
+
+    //   ,       .
+    //     
+    void Reclaim() {
+        std::lock_guard guard(write_mutex_);
+        ReclaimLocked();
+    }
+
+    //    
+    uint64_t GetVersion() const noexcept {
+        return current_.load()->number;
+    }
+
+    //   ,     
+    size_t GetRetiredCount() const {
+        std::lock_guard guard(write_mutex_);
+        return retired_.GetSize();
+    }
+
+private:
+    void PublishLocked(SimpleVector<Type> data) {
+        Version* version = new Version();
+        version->data = std::move(data);
+        version->number = current_.load()->number + 1;
+
+        Version* old_version = current_.exchange(version, std::memory_order_seq_cst);
+        // ,     ,    
+        const uint64_t safe_epoch = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        retired_.PushBack({ old_version, safe_epoch });
+        ReclaimLocked();
+    }
+
+    void ReclaimLocked() {
+        uint64_t min_epoch = UINT64_MAX;
+        for (size_t i = 0; i < max_readers_; ++i) {
+            const uint64_t epoch = slots_[i].epoch.load(std::memory_order_seq_cst);
+            if (epoch != 0 && epoch < min_epoch) {
+                min_epoch = epoch;
+            }
+        }
+
+        size_t kept = 0;
+        for (size_t i = 0; i < retired_.GetSize(); ++i) {
+            if (retired_[i].safe_epoch <= min_epoch) {
+                delete retired_[i].version;
+            } else {
+                retired_[kept++] = retired_[i];
+            }
+        }
+        retired_.Resize(kept);
+    }
+
+    mutable ArrayPtr<ReaderSlot> slots_;
+    const size_t max_readers_;
+    //    1:      
+    std::atomic<uint64_t> epoch_{ 1 };
+    std::atomic<Version*> current_;
+
+    mutable std::mutex write_mutex_;
+    SimpleVector<RetiredVersion> retired_;
+};
@@ -0,0 +1,570 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// ,     Type().
+//    ,   :    ,
+//           ,   ,
+//    O(1).         densify, 
+//      ,       sparsify  .
+//   densify  ,       ,
+//  sparsify  ,     -   .
+//
+//    operator[]  O(log n)      O(1)  .
+//         ForEachNonDefault
+template <typename Type>
+class SparseVector {
+public:
+    using ValueType = Type;
+
+    //     ,    .
+    //    O(n)   
+    class ConstIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        reference operator*() const noexcept {
+            if (owner_->dense_mode_) {
+                return owner_->dense_[index_];
+            }
+            return cursor_ < owner_->indices_.GetSize() && owner_->indices_[cursor_] == index_
+                ? owner_->values_[cursor_]
+                : DEFAULT_VALUE;
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        ConstIterator& operator++() noexcept {
+            if (!owner_->dense_mode_ && cursor_ < owner_->indices_.GetSize() && owner_->indices_[cursor_] == index_) {
+                ++cursor_;
+            }
+            ++index_;
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            ConstIterator result(*this);
+            ++*this;
+            return result;
+        }
+
+        //  ,    
+        size_t GetIndex() const noexcept {
+            return index_;
+        }
+
+        bool operator==(const ConstIterator& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        bool operator!=(const ConstIterator& rhs) const noexcept {
+            return index_ != rhs.index_;
+        }
+
+    private:
+        friend class SparseVector;
+
+        ConstIterator(const SparseVector* owner, size_t index, size_t cursor) noexcept
+            : owner_(owner)
+            , index_(index)
+            , cursor_(cursor)
+        {}
+
+        const SparseVector* owner_ = nullptr;
+        size_t index_ = 0;
+        //    ,   index_
+        size_t cursor_ = 0;
+    };
+
+    using Iterator = ConstIterator;
+
+    SparseVector() noexcept = default;
+
+    //    size   ,     
+    explicit SparseVector(size_t size) noexcept
+        : size_(size)
+    {}
+
+    //      ,   dense;        
+    explicit SparseVector(const SimpleVector<Type>& dense)
+        : size_(dense.GetSize())
+    {
+        Assign(dense);
+    }
+
+    //     ,    
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //   ,   Type()
+    size_t GetNonDefaultCount() const noexcept {
+        return count_;
+    }
+
+    // ,      
+    bool IsDense() const noexcept {
+        return dense_mode_;
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        if (dense_mode_) {
+            return dense_[index];
+        }
+        const size_t pos = LowerBound(index);
+        return pos < indices_.GetSize() && indices_[pos] == index ? values_[pos] : DEFAULT_VALUE;
+    }
+
+    //        index
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        return (*this)[index];
+    }
+
+    //   .  Type()     .
+    //   std::out_of_range,  index >= size.
+    //         ;      O(1)
+    void Set(size_t index, const Type& value) {
+        if (index >= size_) {
+            throw std::out_of_range("index");
+        }
+        const bool is_default = value == DEFAULT_VALUE;
+        if (dense_mode_) {
+            const bool was_default = dense_[index] == DEFAULT_VALUE;
+            dense_[index] = value;
+            if (was_default != is_default) {
+                is_default ? --count_ : ++count_;
+                UpdateMode();
+            }
+            return;
+        }
+
+        const size_t pos = LowerBound(index);
+        const bool found = pos < indices_.GetSize() && indices_[pos] == index;
+        if (found && is_default) {
+            indices_.Erase(indices_.begin() + pos);
+            values_.Erase(values_.begin() + pos);
+            --count_;
+        } else if (found) {
+            values_[pos] = value;
+        } else if (!is_default) {
+            indices_.Insert(indices_.begin() + pos, index);
+            values_.Insert(values_.begin() + pos, value);
+            ++count_;
+            UpdateMode();
+        }
+    }
+
+    //   ;    Type()
+    void Resize(size_t new_size) {
+        if (dense_mode_) {
+            for (size_t i = new_size; i < size_; ++i) {
+                count_ -= dense_[i] != DEFAULT_VALUE;
+            }
+            dense_.Resize(new_size);
+        } else if (new_size < size_) {
+            count_ = LowerBound(new_size);
+            indices_.Resize(count_);
+            values_.Resize(count_);
+        }
+        size_ = new_size;
+        UpdateMode();
+    }
+
+    //     
+    void Clear() noexcept {
+        size_ = 0;
+        count_ = 0;
+        dense_mode_ = false;
+        indices_.Clear();
+        values_.Clear();
+        dense_.Clear();
+    }
+
+    //   :          densify_above,
+    //      sparsify_below.
+    //  std::invalid_argument,  sparsify_below > densify_above
+    void SetDensityThresholds(double sparsify_below, double densify_above) {
+        if (sparsify_below > densify_above) {
+            throw std::invalid_argument("sparsify threshold exceeds densify threshold");
+        }
+        sparsify_below_ = sparsify_below;
+        densify_above_ = densify_above;
+        UpdateMode();
+    }
+
+    //  func(index, value)   ,   Type(),   
+    template <typename Func>
+    void ForEachNonDefault(Func func) const {
+        if (dense_mode_) {
+            for (size_t i = 0; i < size_; ++i) {
+                if (dense_[i] != DEFAULT_VALUE) {
+                    func(i, dense_[i]);
+                }
+            }
+        } else {
+            for (size_t i = 0; i < indices_.GetSize(); ++i) {
+                func(indices_[i], values_[i]);
+            }
+        }
+    }
+
+    //  func(index, value)    :      ForEachNonDefault,
+    //          Type().   , 
+    //      (,  ):     
+    template <typename Func>
+    void ForEachStored(Func func) const {
+        if (dense_mode_) {
+            for (size_t i = 0; i < size_; ++i) {
+                func(i, dense_[i]);
+            }
+        } else {
+            for (size_t i = 0; i < indices_.GetSize(); ++i) {
+                func(indices_[i], values_[i]);
+            }
+        }
+    }
+
+    //       
+    SimpleVector<Type> ToDense() const {
+        if (dense_mode_) {
+            return dense_;
+        }
+        SimpleVector<Type> result(size_);
+        for (size_t i = 0; i < indices_.GetSize(); ++i) {
+            result[indices_[i]] = values_[i];
+        }
+        return result;
+    }
+
+    //      
+    size_t GetMemoryUsage() const noexcept {
+        return sizeof(*this)
+            + indices_.GetCapacity() * sizeof(size_t)
+            + values_.GetCapacity() * sizeof(Type)
+            + dense_.GetCapacity() * sizeof(Type);
+    }
+
+    //     
+    void swap(SparseVector& other) noexcept {
+        std::swap(size_, other.size_);
+        std::swap(count_, other.count_);
+        std::swap(dense_mode_, other.dense_mode_);
+        std::swap(sparsify_below_, other.sparsify_below_);
+        std::swap(densify_above_, other.densify_above_);
+        indices_.swap(other.indices_);
+        values_.swap(other.values_);
+        dense_.swap(other.dense_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_, indices_.GetSize());
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    //      .
+    //  std::invalid_argument,   
+    template <typename Operation>
+    static SparseVector Combine(const SparseVector& lhs, const SparseVector& rhs, Operation operation) {
+        if (lhs.size_ != rhs.size_) {
+            throw std::invalid_argument("vector sizes differ");
+        }
+        if (lhs.dense_mode_ || rhs.dense_mode_) {
+            //      O(n),     
+            SimpleVector<Type> result = lhs.ToDense();
+            SimpleVector<Type> other = rhs.ToDense();
+            for (size_t i = 0; i < result.GetSize(); ++i) {
+                result[i] = operation(result[i], other[i]);
+            }
+            SparseVector sparse;
+            sparse.CopyThresholds(lhs);
+            sparse.size_ = lhs.size_;
+            sparse.Assign(result);
+            return sparse;
+        }
+
+        //     
+        SparseVector result(lhs.size_);
+        result.CopyThresholds(lhs);
+        const size_t lhs_count = lhs.indices_.GetSize();
+        const size_t rhs_count = rhs.indices_.GetSize();
+        result.indices_.Reserve(lhs_count + rhs_count);
+        result.values_.Reserve(lhs_count + rhs_count);
+        size_t i = 0;
+        size_t j = 0;
+        while (i < lhs_count || j < rhs_count) {
+            const size_t lhs_index = i < lhs_count ? lhs.indices_[i] : lhs.size_;
+            const size_t rhs_index = j < rhs_count ? rhs.indices_[j] : rhs.size_;
+            const size_t index = std::min(lhs_index, rhs_index);
+            const Type& lhs_value = lhs_index == index ? lhs.values_[i++] : DEFAULT_VALUE;
+            const Type& rhs_value = rhs_index == index ? rhs.values_[j++] : DEFAULT_VALUE;
+            result.AppendNonDefault(index, operation(lhs_value, rhs_value));
+        }
+        result.UpdateMode();
+        return result;
+    }
+
+    //      func(index, value)  ,   Type()
+    template <typename Func>
+    SparseVector Transform(Func func) const {
+        SparseVector result(size_);
+        result.CopyThresholds(*this);
+        result.indices_.Reserve(count_);
+        result.values_.Reserve(count_);
+        ForEachNonDefault([&result, &func](size_t index, const Type& value) {
+            result.AppendNonDefault(index, func(index, value));
+        });
+        result.UpdateMode();
+        return result;
+    }
+
+private:
+    inline static const Type DEFAULT_VALUE{};
+
+    size_t LowerBound(size_t index) const noexcept {
+        return static_cast<size_t>(std::lower_bound(indices_.begin(), indices_.end(), index) - indices_.begin());
+    }
+
+    //    dense   
+    void Assign(const SimpleVector<Type>& dense) {
+        count_ = static_cast<size_t>(std::count_if(dense.begin(), dense.end(), [](const Type& value) {
+            return value != DEFAULT_VALUE;
+        }));
+        indices_.Clear();
+        values_.Clear();
+        if (IsAboveDensifyThreshold()) {
+            dense_ = dense;
+            dense_mode_ = true;
+            return;
+        }
+        dense_mode_ = false;
+        dense_ = SimpleVector<Type>();
+        indices_.Reserve(count_);
+        values_.Reserve(count_);
+        for (size_t i = 0; i < dense.GetSize(); ++i) {
+            if (dense[i] != DEFAULT_VALUE) {
+                indices_.PushBack(i);
+                values_.PushBack(dense[i]);
+            }
+        }
+    }
+
+    //      ;    
+    void AppendNonDefault(size_t index, const Type& value) {
+        if (value != DEFAULT_VALUE) {
+            indices_.PushBack(index);
+            values_.PushBack(value);
+            ++count_;
+        }
+    }
+
+    void CopyThresholds(const SparseVector& other) noexcept {
+        sparsify_below_ = other.sparsify_below_;
+        densify_above_ = other.densify_above_;
+    }
+
+    bool IsAboveDensifyThreshold() const noexcept {
+        return static_cast<double>(count_) > densify_above_ * static_cast<double>(size_);
+    }
+
+    bool IsBelowSparsifyThreshold() const noexcept {
+        return static_cast<double>(count_) < sparsify_below_ * static_cast<double>(size_);
+    }
+
+    //  ,         
+    void UpdateMode() {
+        if (!dense_mode_ && IsAboveDensifyThreshold()) {
+            SimpleVector<Type> dense = ToDense();
+            indices_ = SimpleVector<size_t>();
+            values_ = SimpleVector<Type>();
+            dense_.swap(dense);
+            dense_mode_ = true;
+        } else if (dense_mode_ && IsBelowSparsifyThreshold()) {
+            SimpleVector<Type> dense;
+            dense.swap(dense_);
+            Assign(dense);
+        }
+    }
+
+    size_t size_ = 0;
+    size_t count_ = 0;
+    bool dense_mode_ = false;
+    //  
+    SimpleVector<size_t> indices_;
+    SimpleVector<Type> values_;
+    //  
+    SimpleVector<Type> dense_;
+    //    sizeof(size_t) + sizeof(Type),   sizeof(Type)
+    double densify_above_ = static_cast<double>(sizeof(Type)) / static_cast<double>(sizeof(Type) + sizeof(size_t));
+    double sparsify_below_ = densify_above_ / 2;
+};
+
+template <typename Type>
+inline bool operator==(const SparseVector<Type>& lhs, const SparseVector<Type>& rhs) {
+    return &lhs == &rhs || (lhs.GetSize() == rhs.GetSize() && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template <typename Type>
+inline bool operator!=(const SparseVector<Type>& lhs, const SparseVector<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+//    O(      sparse).
+//  std::invalid_argument,   
+template <typename Type>
+Type Dot(const SparseVector<Type>& sparse, const SimpleVector<Type>& dense) {
+    if (sparse.GetSize() != dense.GetSize()) {
+        throw std::invalid_argument("vector sizes differ");
+    }
+    Type result{};
+    sparse.ForEachStored([&result, &dense](size_t index, const Type& value) {
+        result += value * dense[index];
+    });
+    return result;
+}
+
+template <typename Type>
+Type Dot(const SimpleVector<Type>& dense, const SparseVector<Type>& sparse) {
+    return Dot(sparse, dense);
+}
+
+template <typename Type>
+Type Dot(const SparseVector<Type>& lhs, const SparseVector<Type>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        throw std::invalid_argument("vector sizes differ");
+    }
+    //      ,    
+    const bool lhs_smaller = lhs.GetNonDefaultCount() <= rhs.GetNonDefaultCount();
+    const SparseVector<Type>& smaller = lhs_smaller ? lhs : rhs;
+    const SparseVector<Type>& other = lhs_smaller ? rhs : lhs;
+    Type result{};
+    smaller.ForEachNonDefault([&result, &other](size_t index, const Type& value) {
+        result += value * other[index];
+    });
+    return result;
+}
+
+//         
+template <typename Type>
+SimpleVector<Type> operator+(const SparseVector<Type>& sparse, const SimpleVector<Type>& dense) {
+    if (sparse.GetSize() != dense.GetSize()) {
+        throw std::invalid_argument("vector sizes differ");
+    }
+    SimpleVector<Type> result(dense);
+    sparse.ForEachStored([&result](size_t index, const Type& value) {
+        result[index] += value;
+    });
+    return result;
+}
+
+template <typename Type>
+SimpleVector<Type> operator+(const SimpleVector<Type>& dense, const SparseVector<Type>& sparse) {
+    return sparse + dense;
+}
+
+template <typename Type>
+SimpleVector<Type> operator-(const SimpleVector<Type>& dense, const SparseVector<Type>& sparse) {
+    if (sparse.GetSize() != dense.GetSize()) {
+        throw std::invalid_argument("vector sizes differ");
+    }
+    SimpleVector<Type> result(dense);
+    sparse.ForEachStored([&result](size_t index, const Type& value) {
+        result[index] -= value;
+    });
+    return result;
+}
+
+template <typename Type>
+SimpleVector<Type> operator-(const SparseVector<Type>& sparse, const SimpleVector<Type>& dense) {
+    if (sparse.GetSize() != dense.GetSize()) {
+        throw std::invalid_argument("vector sizes differ");
+    }
+    SimpleVector<Type> result = sparse.ToDense();
+    for (size_t i = 0; i < result.GetSize(); ++i) {
+        result[i] -= dense[i];
+    }
+    return result;
+}
+
+//        
+template <typename Type>
+SparseVector<Type> operator*(const SparseVector<Type>& sparse, const SimpleVector<Type>& dense) {
+    if (sparse.GetSize() != dense.GetSize()) {
+        throw std::invalid_argument("vector sizes differ");
+    }
+    return sparse.Transform([&dense](size_t index, const Type& value) {
+        return value * dense[index];
+    });
+}
+
+template <typename Type>
+SparseVector<Type> operator*(const SimpleVector<Type>& dense, const SparseVector<Type>& sparse) {
+    return sparse * dense;
+}
+
+template <typename Type>
+SparseVector<Type> operator*(const SparseVector<Type>& sparse, const typename SparseVector<Type>::ValueType& factor) {
+    return sparse.Transform([&factor](size_t, const Type& value) {
+        return value * factor;
+    });
+}
+
+template <typename Type>
+SparseVector<Type> operator*(const typename SparseVector<Type>::ValueType& factor, const SparseVector<Type>& sparse) {
+    return sparse * factor;
+}
+
+template <typename Type>
+SparseVector<Type> operator+(const SparseVector<Type>& lhs, const SparseVector<Type>& rhs) {
+    return SparseVector<Type>::Combine(lhs, rhs, [](const Type& a, const Type& b) {
+        return a + b;
+    });
+}
+
+template <typename Type>
+SparseVector<Type> operator-(const SparseVector<Type>& lhs, const SparseVector<Type>& rhs) {
+    return SparseVector<Type>::Combine(lhs, rhs, [](const Type& a, const Type& b) {
+        return a - b;
+    });
+}
+
+template <typename Type>
+SparseVector<Type> operator*(const SparseVector<Type>& lhs, const SparseVector<Type>& rhs) {
+    return SparseVector<Type>::Combine(lhs, rhs, [](const Type& a, const Type& b) {
+        return a * b;
+    });
+}
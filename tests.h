@@ -1,7 +1,16 @@
 #pragma once
+#include <atomic>
 #include <cassert>
 #include <stdexcept>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 inline void Test1() {
     //    
@@ -240,3 +249,961 @@ inline void Test2() {
 
 
 
+inline void TestGapVector() {
+    //         ,   SimpleVector
+    {
+        GapVector<int> gap{ 1, 2, 3, 4 };
+        SimpleVector<int> simple{ 1, 2, 3, 4 };
+        const size_t positions[] = { 2, 3, 3, 0, 6, 1, 4 };
+        int value = 10;
+        for (const size_t pos : positions) {
+            gap.Insert(gap.begin() + pos, value);
+            simple.Insert(simple.begin() + pos, value);
+            ++value;
+        }
+        gap.Erase(gap.begin() + 5);
+        simple.Erase(simple.begin() + 5);
+        gap.Erase(gap.begin());
+        simple.Erase(simple.begin());
+
+        assert(gap.GetSize() == simple.GetSize());
+        assert(std::equal(gap.begin(), gap.end(), simple.begin(), simple.end()));
+        for (size_t i = 0; i < gap.GetSize(); ++i) {
+            assert(gap[i] == simple[i]);
+        }
+    }
+
+    //      
+    {
+        GapVector<int> v(10);
+        auto it = v.Insert(v.begin() + 4, 42);
+        assert(*it == 42);
+        assert(v.GetGapPosition() == 5);
+        it = v.Erase(v.begin() + 2);
+        assert(v.GetGapPosition() == 2);
+        assert(*(it + 1) == 42);
+        assert(v.GetSize() == 10);
+    }
+
+    // PushBack, PopBack  At
+    {
+        GapVector<int> v;
+        for (int i = 0; i < 5; ++i) {
+            v.PushBack(i);
+        }
+        v.Insert(v.begin(), -1);
+        v.PopBack();
+        assert((v == GapVector<int>{ -1, 0, 1, 2, 3 }));
+        assert(v.At(4) == 3);
+        try {
+            v.At(5);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+    }
+
+    // ,   Reserve
+    {
+        GapVector<int> v{ 1, 2, 3 };
+        v.Insert(v.begin() + 1, 7);
+        v.Reserve(100);
+        assert(v.GetCapacity() == 100);
+        assert((v == GapVector<int>{ 1, 7, 2, 3 }));
+
+        GapVector<int> copy(v);
+        assert(copy == v);
+        GapVector<int> moved(std::move(copy));
+        assert(moved == v);
+        assert(copy.IsEmpty());
+    }
+
+    //            
+    {
+        GapVector<int> v{ 1, 2 };
+        v.PushBack(v[0]);
+        assert((v == GapVector<int>{ 1, 2, 1 }));
+
+        const std::string long_value(40, 'x');
+        GapVector<std::string> strings{ long_value, "b" };
+        strings.PushBack(strings[0]);
+        strings.Insert(strings.begin(), strings[2]);
+        assert(strings.GetSize() == 4 && strings[0] == long_value && strings[3] == long_value);
+    }
+}
+
+inline void TestRingVector() {
+    // :   ,   
+    {
+        RingVector<int> v;
+        for (int i = 0; i < 5; ++i) {
+            v.PushBack(i);
+        }
+        v.PopFront();
+        v.PopFront();
+        v.PushBack(5);
+        v.PushBack(6);
+        assert((v == RingVector<int>{ 2, 3, 4, 5, 6 }));
+        assert(v.Front() == 2);
+        assert(v.Back() == 6);
+    }
+
+    //      
+    {
+        RingVector<int> v{ 1, 2, 3 };
+        v.PushFront(0);
+        v.PushFront(-1);
+        v.PopBack();
+        assert((v == RingVector<int>{ -1, 0, 1, 2 }));
+        assert(v.At(3) == 2);
+        try {
+            v.At(4);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+    }
+
+    // ,    ,     
+    {
+        RingVector<int> v(Reserve(4));
+        v.PushBack(1);
+        v.PushBack(2);
+        v.PushBack(3);
+        v.PopFront();
+        v.PopFront();
+        v.PushBack(4);
+        v.PushBack(5);
+        assert(v.GetCapacity() == 4);
+        const auto [first, second] = v.GetSegments();
+        assert(first.size == 2 && first.data[0] == 3 && first.data[1] == 4);
+        assert(second.size == 1 && second.data[0] == 5);
+
+        //       
+        v.PushBack(6);
+        v.PushBack(7);
+        assert(v.GetCapacity() == 8);
+        assert(v.GetSegments().second.size == 0);
+        assert((v == RingVector<int>{ 3, 4, 5, 6, 7 }));
+    }
+
+    //      
+    {
+        RingVector<int> window(Reserve(3), RingOverflow::Overwrite);
+        for (int i = 0; i < 10; ++i) {
+            window.PushBack(i);
+        }
+        assert(window.GetCapacity() == 3);
+        assert((window == RingVector<int>{ 7, 8, 9 }));
+        window.PushFront(42);
+        assert((window == RingVector<int>{ 42, 7, 8 }));
+
+        RingVector<int> copy(window);
+        assert(copy.GetCapacity() == 3);
+        copy.PushBack(1);
+        assert((copy == RingVector<int>{ 7, 8, 1 }));
+    }
+
+    //  
+    {
+        RingVector<std::unique_ptr<int>> v;
+        v.PushBack(std::make_unique<int>(1));
+        v.PushFront(std::make_unique<int>(0));
+        assert(*v[0] == 0 && *v[1] == 1);
+        RingVector<std::unique_ptr<int>> moved(std::move(v));
+        assert(moved.GetSize() == 2);
+        assert(v.IsEmpty());
+    }
+
+    //        
+    {
+        const std::string long_value(40, 'x');
+        RingVector<std::string> v{ long_value, "b" };
+        v.PushBack(v[0]);
+        v.PushFront(v[2]);
+        assert(v.GetSize() == 4 && v[0] == long_value && v[3] == long_value);
+
+        RingVector<std::string> window(Reserve(2), RingOverflow::Overwrite);
+        window.PushBack(long_value);
+        window.PushBack("b");
+        window.PushBack(window[0]);
+        assert(window.GetSize() == 2 && window[0] == "b" && window[1] == long_value);
+    }
+}
+
+inline void TestCompressedVector() {
+    //     
+    {
+        CompressedVector<uint64_t> compressed;
+        SimpleVector<uint64_t> plain;
+        uint64_t id = 1'000'000'000'000ull;
+        for (size_t i = 0; i < 1024; ++i) {
+            id += i % 7;
+            compressed.PushBack(id);
+            plain.PushBack(id);
+        }
+        assert(compressed.GetSize() == plain.GetSize());
+        for (size_t i = 0; i < plain.GetSize(); ++i) {
+            assert(compressed[i] == plain[i]);
+        }
+        assert(std::equal(compressed.begin(), compressed.end(), plain.begin(), plain.end()));
+        assert(compressed.GetBitsPerElement() < 16.0);
+
+        SimpleVector<uint64_t> decoded(300);
+        compressed.Decode(100, 300, decoded.begin());
+        assert(std::equal(decoded.begin(), decoded.end(), plain.begin() + 100));
+        decoded.Resize(900);
+        compressed.Decode(100, 900, decoded.begin());
+        assert(std::equal(decoded.begin(), decoded.end(), plain.begin() + 100));
+    }
+
+    //  ,       
+    {
+        CompressedVector<int32_t> compressed;
+        SimpleVector<int32_t> plain;
+        for (int32_t i = 0; i < 300; ++i) {
+            const int32_t value = i < 128 ? -5 : (i % 2 == 0 ? std::numeric_limits<int32_t>::min() : std::numeric_limits<int32_t>::max() - i);
+            compressed.PushBack(value);
+            plain.PushBack(value);
+        }
+        for (size_t i = 0; i < plain.GetSize(); ++i) {
+            assert(compressed.At(i) == plain[i]);
+        }
+        try {
+            compressed.At(300);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+
+        compressed.Clear();
+        assert(compressed.IsEmpty());
+        compressed.PushBack(1);
+        assert((compressed == CompressedVector<int32_t>{ 1 }));
+    }
+
+    // 64-    
+    {
+        CompressedVector<uint64_t> compressed;
+        for (uint64_t i = 0; i < 256; ++i) {
+            compressed.PushBack(i % 2 == 0 ? 0 : ~uint64_t{ 0 } - i);
+        }
+        for (uint64_t i = 0; i < 256; ++i) {
+            assert(compressed[i] == (i % 2 == 0 ? 0 : ~uint64_t{ 0 } - i));
+        }
+    }
+}
+
+inline void TestSnapshotVector() {
+    //       
+    {
+        SnapshotVector<int> v(SimpleVector<int>{ 1, 2, 3 });
+        auto reader = v.RegisterReader();
+        {
+            const auto snapshot = reader.Acquire();
+            assert(snapshot.GetVersion() == 0);
+
+            v.Update([](SimpleVector<int>& data) {
+                data.PushBack(4);
+                data[0] = 10;
+            });
+            assert(v.GetVersion() == 1);
+            assert((snapshot.GetData() == SimpleVector<int>{ 1, 2, 3 }));
+            //    
+            assert(v.GetRetiredCount() == 1);
+        }
+        v.Reclaim();
+        assert(v.GetRetiredCount() == 0);
+
+        const auto snapshot = reader.Acquire();
+        assert((snapshot.GetData() == SimpleVector<int>{ 10, 2, 3, 4 }));
+
+        SimpleVector<int> batch = v.Edit();
+        batch.PopBack();
+        v.Publish(std::move(batch));
+        assert(snapshot.GetSize() == 4);
+        assert(reader.Acquire().GetSize() == 3);
+    }
+
+    //   ,     Reader
+    {
+        SnapshotVector<int> v(2);
+        auto reader1 = v.RegisterReader();
+        {
+            auto reader2 = v.RegisterReader();
+            try {
+                v.RegisterReader();
+                assert(false);
+            }
+            catch (const std::length_error&) {
+            }
+        }
+        auto reader3 = v.RegisterReader();
+    }
+
+    //        
+    {
+        SnapshotVector<int> v(SimpleVector<int>(100, 0));
+        std::atomic<bool> stop{ false };
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&v, &stop] {
+                auto reader = v.RegisterReader();
+                while (!stop.load()) {
+                    const auto snapshot = reader.Acquire();
+                    const int expected = static_cast<int>(snapshot.GetVersion());
+                    for (const int value : snapshot) {
+                        assert(value == expected);
+                    }
+                }
+            });
+        }
+        for (int version = 1; version <= 200; ++version) {
+            v.Publish(SimpleVector<int>(100, version));
+        }
+        stop = true;
+        for (auto& thread : readers) {
+            thread.join();
+        }
+        v.Reclaim();
+        assert(v.GetRetiredCount() == 0);
+    }
+}
+
+inline void TestRadixSort() {
+    std::mt19937_64 generator(7);
+
+    //    
+    {
+        SimpleVector<uint32_t> keys;
+        SimpleVector<int64_t> signed_keys;
+        for (int i = 0; i < 5000; ++i) {
+            keys.PushBack(static_cast<uint32_t>(generator()));
+            signed_keys.PushBack(static_cast<int64_t>(generator()) >> (i % 40));
+        }
+        SimpleVector<uint32_t> expected(keys);
+        std::sort(expected.begin(), expected.end());
+        SimpleVector<uint32_t> scratch;
+        RadixSort(keys, scratch);
+        assert(keys == expected);
+
+        SimpleVector<int64_t> expected_signed(signed_keys);
+        std::sort(expected_signed.begin(), expected_signed.end());
+        SimpleVector<int64_t> msd_keys(signed_keys);
+        SimpleVector<int64_t> parallel_keys(signed_keys);
+        RadixSort(signed_keys);
+        assert(signed_keys == expected_signed);
+        MsdRadixSort(msd_keys);
+        assert(msd_keys == expected_signed);
+        ParallelRadixSort(parallel_keys, 3);
+        assert(parallel_keys == expected_signed);
+    }
+
+    //    ,    
+    {
+        SimpleVector<double> keys{ 3.5, -0.25, 0.0, -1e300, 1e-300, 2.0, -7.0, 1e300 };
+        SimpleVector<double> expected(keys);
+        std::sort(expected.begin(), expected.end());
+        SimpleVector<double> msd_keys(keys);
+        RadixSort(keys);
+        assert(keys == expected);
+        MsdRadixSort(msd_keys);
+        assert(msd_keys == expected);
+
+        SimpleVector<float> float_keys;
+        for (int i = 0; i < 1000; ++i) {
+            float_keys.PushBack(std::uniform_real_distribution<float>(-100.0f, 100.0f)(generator));
+        }
+        SimpleVector<float> expected_floats(float_keys);
+        std::sort(expected_floats.begin(), expected_floats.end());
+        RadixSort(float_keys);
+        assert(float_keys == expected_floats);
+    }
+
+    //     
+    {
+        struct Record {
+            uint16_t key = 0;
+            int order = 0;
+        };
+        SimpleVector<Record> records;
+        for (int i = 0; i < 1000; ++i) {
+            records.PushBack({ static_cast<uint16_t>(generator() % 10), i });
+        }
+        RadixSortBy(records, [](const Record& record) {
+            return record.key;
+        });
+        for (size_t i = 1; i < records.GetSize(); ++i) {
+            assert(records[i - 1].key < records[i].key
+                   || (records[i - 1].key == records[i].key && records[i - 1].order < records[i].order));
+        }
+    }
+
+    //  -
+    {
+        SimpleVector<int32_t> keys{ 5, -3, 5, 0, -3 };
+        SimpleVector<size_t> indices{ 0, 1, 2, 3, 4 };
+        RadixSortPairs(keys, indices);
+        assert((keys == SimpleVector<int32_t>{ -3, -3, 0, 5, 5 }));
+        assert((indices == SimpleVector<size_t>{ 1, 4, 3, 0, 2 }));
+    }
+
+    //     
+    {
+        SimpleVector<uint64_t> keys(Reserve(300000));
+        for (size_t i = 0; i < 300000; ++i) {
+            keys.PushBack(generator() % 1000000);
+        }
+        SimpleVector<uint64_t> expected(keys);
+        std::sort(expected.begin(), expected.end());
+        ParallelRadixSort(keys, 4);
+        assert(keys == expected);
+    }
+}
+
+inline void TestExternalVector() {
+    ExternalVectorOptions options;
+    options.block_bytes = 64 * sizeof(int);
+    options.ram_budget_bytes = 4 * options.block_bytes;
+    options.read_ahead_blocks = 2;
+
+    // ,    ,   
+    {
+        ExternalVector<int> v(options);
+        assert(v.GetCachedBlockLimit() == 4);
+        assert(v.GetBlockSize() == 64);
+        for (int i = 0; i < 10000; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.GetSize() == 10000);
+        assert(v.GetStats().blocks_written > 0);
+
+        for (size_t i = 0; i < v.GetSize(); i += 997) {
+            assert(v[i] == static_cast<int>(i));
+        }
+        int expected = 0;
+        for (const int value : v) {
+            assert(value == expected++);
+        }
+        assert(expected == 10000);
+
+        //    
+        v.Set(5, -5);
+        v.Set(9999, -9999);
+        assert(v.At(9000) == 9000);
+        assert(v.At(5) == -5);
+        assert(v.At(9999) == -9999);
+        try {
+            v.At(10000);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        try {
+            v.Set(10000, 0);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+
+        //     ,       
+        v.Flush();
+        v.ResetStats();
+        for (size_t i = 0; i < v.GetSize(); i += 331) {
+            assert(v[i] == (i == 5 ? -5 : static_cast<int>(i)));
+        }
+        assert(v.GetStats().blocks_read > 0);
+        assert(v.GetStats().blocks_written == 0);
+    }
+
+    //      
+    {
+        ExternalVector<uint64_t> v(options);
+        for (uint64_t i = 0; i < 4096; ++i) {
+            v.PushBack(i * i);
+        }
+        v.Flush();
+        v.ResetStats();
+        uint64_t sum = 0;
+        for (const uint64_t value : v) {
+            sum += value;
+        }
+        //   0..n-1  (n-1)n(2n-1)/6
+        assert(sum == uint64_t{ 4095 } * 4096 * 8191 / 6);
+        const auto& stats = v.GetStats();
+        assert(stats.blocks_read == 4096 * sizeof(uint64_t) / options.block_bytes);
+        // ,  ,       
+        assert(stats.misses < stats.blocks_read);
+        assert(stats.file_reads == stats.misses);
+    }
+}
+
+inline void TestIncrementalVector() {
+    //      
+    {
+        IncrementalVector<int> v(3);
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+            if (v.IsMigrating()) {
+                for (int j = 0; j <= i; ++j) {
+                    assert(v[j] == j);
+                }
+            }
+        }
+        assert(v.GetSize() == 1000);
+        assert(v.GetCapacity() == 1024);
+        int expected = 0;
+        for (const int value : v) {
+            assert(value == expected++);
+        }
+    }
+
+    //        
+    {
+        IncrementalVector<int> v(2);
+        for (int i = 0; i < 16; ++i) {
+            v.PushBack(i);
+        }
+        assert(!v.IsMigrating());
+        v.PushBack(16);
+        assert(v.IsMigrating());
+        assert(v.GetCapacity() == 32);
+        v[3] = -3;
+        v.PopBack();
+        v.PopBack();
+        assert(v.GetSize() == 15);
+        v.FinishMigration();
+        assert(!v.IsMigrating());
+        assert(v[3] == -3 && v[14] == 14);
+        assert(v.At(0) == 0);
+        try {
+            v.At(15);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+    }
+
+    //    PopBack   
+    {
+        IncrementalVector<std::unique_ptr<int>> v(1);
+        for (int i = 0; i < 9; ++i) {
+            v.PushBack(std::make_unique<int>(i));
+        }
+        assert(v.IsMigrating());
+        for (int i = 0; i < 8; ++i) {
+            v.PopBack();
+        }
+        assert(!v.IsMigrating());
+        assert(v.GetSize() == 1 && *v[0] == 0);
+        v.Reserve(100);
+        assert(v.GetCapacity() == 100 && *v[0] == 0);
+    }
+
+    //     ,   
+    {
+        const std::string long_value(100, 'x');
+        IncrementalVector<std::string> v(1);
+        v.PushBack(long_value);
+        for (int i = 0; i < 3; ++i) {
+            v.PushBack(std::string(50, 'a' + i));
+        }
+        assert(v.GetSize() == v.GetCapacity() && !v.IsMigrating());
+        v.PushBack(v[0]);
+        assert(v.IsMigrating());
+        assert(v[0] == long_value && v[4] == long_value);
+        v.FinishMigration();
+        assert(v[0] == long_value && v[3] == std::string(50, 'c') && v[4] == long_value);
+    }
+}
+
+inline void TestBufferPool() {
+    BufferPool::ResetBucketLimits();
+    BufferPool::Trim();
+    BufferPool::ResetStats();
+
+    //    - 
+    assert(BufferPool::GetBucket(1) == 0);
+    assert(BufferPool::GetBucket(64) == 0);
+    assert(BufferPool::GetBucket(65) == 1);
+    assert(BufferPool::GetBucketBytes(BufferPool::GetBucket(1000)) == 1024);
+
+    //        
+    {
+        const BufferPoolBlock first = BufferPool::Allocate(1000);
+        assert(first.bytes == 1024);
+        BufferPool::Deallocate(first);
+        const BufferPoolBlock second = BufferPool::Allocate(900);
+        assert(second.data == first.data);
+        BufferPool::Deallocate(second);
+        const BufferPoolStats stats = BufferPool::GetStats();
+        assert(stats.misses == 1 && stats.hits == 1 && stats.recycled == 2);
+    }
+
+    //      
+    {
+        BufferPool::Trim();
+        BufferPool::ResetStats();
+        BufferPool::SetBucketLimit(4096, 1);
+        assert(BufferPool::GetBucketLimit(4096) == 1);
+        const BufferPoolBlock a = BufferPool::Allocate(4096);
+        const BufferPoolBlock b = BufferPool::Allocate(4096);
+        const BufferPoolBlock c = BufferPool::Allocate(4096);
+        BufferPool::Deallocate(a);  //   
+        BufferPool::Deallocate(b);  //   
+        BufferPool::Deallocate(c);  //  
+        assert(BufferPool::GetStats().recycled == 2 && BufferPool::GetStats().released == 1);
+        BufferPool::ResetBucketLimits();
+    }
+
+    //   :       ,     
+    {
+        BufferPool::Trim();
+        BufferPool::ResetStats();
+        BufferPool::SetCacheCapacity(2 * 4096, 2 * 4096);
+        BufferPoolBlock blocks[5];
+        for (BufferPoolBlock& block : blocks) {
+            block = BufferPool::Allocate(4096);
+        }
+        for (const BufferPoolBlock& block : blocks) {
+            BufferPool::Deallocate(block);
+        }
+        assert(BufferPool::GetStats().recycled == 4 && BufferPool::GetStats().released == 1);
+        assert(BufferPool::GetCachedBytes() == 4 * 4096);
+        BufferPool::ResetCacheCapacity();
+    }
+
+    // Trim  
+    {
+        BufferPool::Trim();
+        BufferPool::ResetStats();
+        BufferPool::Deallocate(BufferPool::Allocate(256));
+        assert(BufferPool::GetCachedBytes() == 256);
+        BufferPool::Trim();
+        assert(BufferPool::GetCachedBytes() == 0);
+        BufferPool::Deallocate(BufferPool::Allocate(256));
+        assert(BufferPool::GetStats().misses == 2 && BufferPool::GetStats().hits == 0);
+
+        // Trim            
+        std::thread([] { BufferPool::Trim(); }).join();
+        assert(BufferPool::GetCachedBytes() == 0);
+    }
+
+    //       
+    {
+        BufferPool::Trim();
+        void* data = nullptr;
+        std::thread worker([&data] {
+            const BufferPoolBlock block = BufferPool::Allocate(10000);
+            data = block.data;
+            BufferPool::Deallocate(block);
+        });
+        worker.join();
+        BufferPool::ResetStats();
+        const BufferPoolBlock reused = BufferPool::Allocate(10000);
+        assert(reused.data == data && BufferPool::GetStats().hits == 1);
+        BufferPool::Deallocate(reused);
+    }
+
+    //           ,
+    //        
+    {
+        BufferPool::Trim();
+        BufferPool::SetBucketLimit(3000, 0);
+        const BufferPoolBlock block = BufferPool::Allocate(3000);
+        assert(block.bytes == 3000);
+        BufferPool::ResetBucketLimits();
+        BufferPool::ResetStats();
+        BufferPool::Deallocate(block);
+        assert(BufferPool::GetStats().released == 1 && BufferPool::GetCachedBytes() == 0);
+    }
+
+    //         
+    {
+        BufferPool::Trim();
+        const size_t large = BufferPool::MAX_POOLED_BYTES + 12345;
+        const BufferPoolBlock block = BufferPool::Allocate(large);
+        assert(block.bytes == large);
+        BufferPool::Deallocate(block);
+        assert(BufferPool::GetBucketLimit(BufferPool::BUCKET_BUDGET_BYTES) == 1);
+        assert(BufferPool::GetBucketLimit(2 * BufferPool::BUCKET_BUDGET_BYTES) == 0);
+        assert(BufferPool::GetBucketLimit(large) == 0);
+
+        BufferPool::ResetStats();
+        {
+            SimpleVector<char> v(size_t{ 64 } << 20);
+            v[0] = 1;
+        }
+        const BufferPoolStats stats = BufferPool::GetStats();
+        assert(stats.misses == 1 && stats.released == 1 && stats.recycled == 0);
+        assert(BufferPool::GetCachedBytes() == 0);
+    }
+
+    //  SimpleVector      
+    {
+        BufferPool::Trim();
+        for (int pass = 0; pass < 2; ++pass) {
+            BufferPool::ResetStats();
+            SimpleVector<int> v;
+            for (int i = 0; i < 1000; ++i) {
+                v.PushBack(i);
+            }
+            v.Insert(v.begin(), -1);
+            SimpleVector<int> w;
+            w.Reserve(3000);
+            assert(v.GetSize() == 1001 && v[0] == -1 && v[1000] == 999);
+            if (pass == 1) {
+                assert(BufferPool::GetStats().misses == 0);
+            }
+        }
+    }
+
+    //      
+    {
+        {
+            SimpleVector<std::string> v(10, std::string(100, 'x'));
+        }
+        SimpleVector<std::string> v(10);
+        for (const std::string& s : v) {
+            assert(s.empty());
+        }
+    }
+    BufferPool::Trim();
+}
+
+inline void TestVectorExpression() {
+    const SimpleVector<double> a{ 1.0, 2.0, 3.0, 4.0 };
+    const SimpleVector<double> b{ 10.0, 20.0, 30.0, 40.0 };
+    const SimpleVector<double> c{ 0.5, 0.5, 0.5, 0.5 };
+
+    //     
+    {
+        SimpleVector<double> r = a * 2.0 + b - c;
+        assert((r == SimpleVector<double>{ 11.5, 23.5, 35.5, 47.5 }));
+        r = -b / (a + 1.0);
+        assert((r == SimpleVector<double>{ -5.0, -20.0 / 3.0, -7.5, -8.0 }));
+    }
+
+    //     ,     
+    {
+        SimpleVector<double> r(4);
+        const double* data = r.begin();
+        r = a + b;
+        r = r * 2.0 + a;
+        assert(r.begin() == data);
+        assert((r == SimpleVector<double>{ 23.0, 46.0, 69.0, 92.0 }));
+
+        SimpleVector<double> small;
+        small = a - a;
+        assert(small.GetSize() == 4 && small.GetCapacity() == 4 && small[3] == 0.0);
+    }
+
+    //     
+    {
+        const SimpleVector<int> n{ -4, 9, -16 };
+        SimpleVector<double> r = Sqrt(Abs(n));
+        assert((r == SimpleVector<double>{ 2.0, 3.0, 4.0 }));
+        r = n * 0.5;
+        assert((r == SimpleVector<double>{ -2.0, 4.5, -8.0 }));
+        SimpleVector<int> m = Max(Min(n, 5), -10);
+        assert((m == SimpleVector<int>{ -4, 5, -10 }));
+        r = Pow(a, 2) - Exp(Log(a)) * Cos(a - a) + Sin(a * 0.0);
+        assert((r == SimpleVector<double>{ 0.0, 2.0, 6.0, 12.0 }));
+    }
+
+    //   
+    {
+        const SimpleVector<double> shorter{ 1.0, 2.0 };
+        try {
+            SimpleVector<double> r = a + shorter;
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {
+        }
+    }
+
+    //     
+    {
+        const size_t size = 300000;
+        SimpleVector<double> x(size);
+        SimpleVector<double> y(size);
+        for (size_t i = 0; i < size; ++i) {
+            x[i] = static_cast<double>(i);
+            y[i] = static_cast<double>(size - i);
+        }
+        SimpleVector<double> serial = x * y + x;
+        SimpleVector<double> parallel = Parallel(x * y + x, 4);
+        assert(serial == parallel);
+        // Parallel   : Parallel(x * y) + x      
+        static_assert(!expression_detail::IS_OPERAND<decltype(Parallel(x * y))>);
+    }
+}
+
+inline void TestSparseVector() {
+    //        
+    {
+        SparseVector<float> v(1'000'000);
+        assert(v.GetSize() == 1'000'000 && v.GetNonDefaultCount() == 0 && !v.IsDense());
+        assert(v.GetMemoryUsage() < 1000);
+        v.Set(500, 2.0f);
+        v.Set(10, 1.0f);
+        v.Set(999'999, 3.0f);
+        assert(v[10] == 1.0f && v[500] == 2.0f && v[999'999] == 3.0f && v[11] == 0.0f);
+        assert(v.GetNonDefaultCount() == 3);
+        v.Set(500, 0.0f);
+        assert(v.GetNonDefaultCount() == 2 && v[500] == 0.0f);
+        try {
+            v.Set(1'000'000, 1.0f);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+
+        size_t visited = 0;
+        v.ForEachNonDefault([&visited](size_t index, float value) {
+            assert((visited == 0 && index == 10 && value == 1.0f) || (visited == 1 && index == 999'999 && value == 3.0f));
+            ++visited;
+        });
+        assert(visited == 2);
+    }
+
+    //        
+    {
+        const SimpleVector<int> dense{ 0, 5, 0, 0, 7, 0, 0, 0, 0, 0, 0, 1 };
+        const SparseVector<int> v(dense);
+        assert(!v.IsDense() && v.GetNonDefaultCount() == 3);
+        assert(std::equal(v.begin(), v.end(), dense.begin(), dense.end()));
+        assert(v.ToDense() == dense);
+        assert(v.At(4) == 7);
+        try {
+            v.At(12);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+    }
+
+    //     
+    {
+        SparseVector<double> v(100);
+        v.SetDensityThresholds(0.1, 0.3);
+        for (size_t i = 0; i < 30; ++i) {
+            v.Set(i, 1.0);
+        }
+        assert(!v.IsDense());
+        v.Set(30, 1.0);
+        assert(v.IsDense() && v[30] == 1.0 && v[31] == 0.0);
+        for (size_t i = 0; i < 21; ++i) {
+            v.Set(i, 0.0);
+        }
+        assert(v.IsDense() && v.GetNonDefaultCount() == 10);
+        v.Set(21, 0.0);
+        assert(!v.IsDense() && v.GetNonDefaultCount() == 9 && v[30] == 1.0 && v[21] == 0.0);
+        try {
+            v.SetDensityThresholds(0.5, 0.1);
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {
+        }
+
+        v.Resize(25);
+        assert(v.GetSize() == 25 && v.GetNonDefaultCount() == 3);
+    }
+
+    //      
+    {
+        const SimpleVector<int> dense{ 1, 2, 3, 4, 5, 6, 7, 8 };
+        SparseVector<int> a(8);
+        a.Set(1, 10);
+        a.Set(6, 20);
+        SparseVector<int> b(8);
+        b.Set(6, 2);
+        b.Set(7, 3);
+
+        assert(Dot(a, dense) == 10 * 2 + 20 * 7);
+        assert(Dot(dense, a) == Dot(a, dense));
+        assert(Dot(a, b) == 40);
+        assert((a + dense == SimpleVector<int>{ 1, 12, 3, 4, 5, 6, 27, 8 }));
+        assert((dense - a == SimpleVector<int>{ 1, -8, 3, 4, 5, 6, -13, 8 }));
+        assert((a - dense == SimpleVector<int>{ -1, 8, -3, -4, -5, -6, 13, -8 }));
+
+        const SparseVector<int> product = a * dense;
+        assert(product.GetNonDefaultCount() == 2 && product[1] == 20 && product[6] == 140);
+        assert((2 * a)[6] == 40 && (a * 0).GetNonDefaultCount() == 0);
+
+        const SparseVector<int> sum = a + b;
+        assert(sum.GetNonDefaultCount() == 3 && sum[1] == 10 && sum[6] == 22 && sum[7] == 3);
+        assert((a - a).GetNonDefaultCount() == 0);
+        const SparseVector<int> both = a * b;
+        assert(both.GetNonDefaultCount() == 1 && both[6] == 40);
+
+        //  
+        const SparseVector<int> full(dense);
+        assert(full.IsDense());
+        assert((full + a)[1] == 12 && (full * b).GetNonDefaultCount() == 2);
+
+        const SparseVector<int> shorter(3);
+        try {
+            Dot(shorter, dense);
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {
+        }
+    }
+}
+
+inline void TestHashedVector() {
+    //     ,      
+    {
+        const std::hash<SimpleVector<uint8_t>> hasher;
+        SimpleVector<uint8_t> key;
+        std::unordered_set<size_t> hashes;
+        for (int i = 0; i < 200; ++i) {
+            hashes.insert(hasher(key));
+            key.PushBack(static_cast<uint8_t>(i * 7));
+        }
+        assert(hashes.size() == 200);
+        SimpleVector<uint8_t> copy(key);
+        assert(hasher(copy) == hasher(key));
+        copy[150] ^= 1;
+        assert(hasher(copy) != hasher(key));
+        assert(HashBytes("abc", 3) != HashBytes("abd", 3) && HashBytes("abc", 3, 1) != HashBytes("abc", 3));
+    }
+
+    //      
+    {
+        std::unordered_set<SimpleVector<std::string>> set;
+        set.insert(SimpleVector<std::string>{ "a", "bc" });
+        set.insert(SimpleVector<std::string>{ "ab", "c" });
+        set.insert(SimpleVector<std::string>{ "a", "bc" });
+        assert(set.size() == 2);
+        assert(set.count(SimpleVector<std::string>{ "ab", "c" }) == 1);
+    }
+
+    // HashedVector       
+    {
+        HashedVector<int32_t> key{ 1, 2, 3 };
+        assert(!key.HasCachedHash());
+        const size_t hash = key.GetHash();
+        assert(key.HasCachedHash() && hash == std::hash<SimpleVector<int32_t>>{}(key.GetVector()));
+        const HashedVector<int32_t>& const_key = key;
+        assert(const_key[1] == 2 && key.HasCachedHash());
+        key[1] = 5;
+        assert(!key.HasCachedHash() && key.GetHash() != hash);
+        key.Modify([](SimpleVector<int32_t>& v) {
+            v[1] = 2;
+        });
+        assert(key.GetHash() == hash);
+        key.PushBack(4);
+        assert(!key.HasCachedHash() && key.GetSize() == 4);
+
+        std::unordered_map<HashedVector<int32_t>, int> map;
+        map[HashedVector<int32_t>{ 1, 2 }] = 12;
+        map[HashedVector<int32_t>{ 2, 1 }] = 21;
+        assert(map.at(HashedVector<int32_t>{ 1, 2 }) == 12);
+        assert(map.count(HashedVector<int32_t>{ 1 }) == 0);
+        assert((key != HashedVector<int32_t>{ 1, 2, 3 }));
+        key.PopBack();
+        assert((key == HashedVector<int32_t>{ 1, 2, 3 }));
+    }
+}
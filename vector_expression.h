@@ -0,0 +1,405 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//     SimpleVector  .
+//  +, -, *, /   Sqrt, Abs, Exp, Log, Sin, Cos, Pow, Min, Max  
+//  ,    .      SimpleVector
+//  :  r = a * 2 + b - c    
+// r[i] = a[i] * 2 + b[i] - c[i],   .    ,
+//    r ,      .
+//           ,
+//  r = r * 2 + a .
+//
+//      -   ,
+//   ;    ,    
+
+template <typename Derived>
+class VectorExpression {
+public:
+    const Derived& Self() const noexcept {
+        return static_cast<const Derived&>(*this);
+    }
+
+    size_t GetSize() const noexcept {
+        return Self().GetSize();
+    }
+
+    //   [first, last)  out.      
+    template <typename Out>
+    void EvaluateInto(Out* out, size_t first, size_t last) const {
+        const Derived& self = Self();
+        for (size_t i = first; i < last; ++i) {
+            out[i] = static_cast<Out>(self[i]);
+        }
+    }
+
+protected:
+    VectorExpression() = default;
+};
+
+namespace expression_detail {
+
+//  :  SimpleVector
+template <typename Type>
+class VectorView : public VectorExpression<VectorView<Type>> {
+public:
+    explicit VectorView(const SimpleVector<Type>& vector) noexcept
+        : data_(vector.begin())
+        , size_(vector.GetSize())
+    {}
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    Type operator[](size_t index) const noexcept {
+        return data_[index];
+    }
+
+private:
+    const Type* data_;
+    size_t size_;
+};
+
+// ,      
+template <typename Type>
+class ScalarValue {
+public:
+    explicit ScalarValue(Type value) noexcept
+        : value_(value)
+    {}
+
+    Type operator[](size_t) const noexcept {
+        return value_;
+    }
+
+private:
+    Type value_;
+};
+
+template <typename Operation, typename Operand>
+class UnaryExpression : public VectorExpression<UnaryExpression<Operation, Operand>> {
+public:
+    explicit UnaryExpression(const Operand& operand) noexcept
+        : operand_(operand)
+    {}
+
+    size_t GetSize() const noexcept {
+        return operand_.GetSize();
+    }
+
+    auto operator[](size_t index) const noexcept {
+        return Operation{}(operand_[index]);
+    }
+
+private:
+    Operand operand_;
+};
+
+template <typename Operation, typename Left, typename Right>
+class BinaryExpression : public VectorExpression<BinaryExpression<Operation, Left, Right>> {
+public:
+    BinaryExpression(const Left& left, const Right& right, size_t size) noexcept
+        : left_(left)
+        , right_(right)
+        , size_(size)
+    {}
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    auto operator[](size_t index) const noexcept {
+        return Operation{}(left_[index], right_[index]);
+    }
+
+private:
+    Left left_;
+    Right right_;
+    size_t size_;
+};
+
+//    ,     .
+//    EvaluateInto,      ,
+//  ParallelExpression     (. IS_VECTOR_OPERAND)
+template <typename Inner>
+class ParallelExpression : public VectorExpression<ParallelExpression<Inner>> {
+public:
+    ParallelExpression(const Inner& inner, size_t thread_count) noexcept
+        : inner_(inner)
+        , thread_count_(thread_count)
+    {}
+
+    size_t GetSize() const noexcept {
+        return inner_.GetSize();
+    }
+
+    auto operator[](size_t index) const noexcept {
+        return inner_[index];
+    }
+
+    template <typename Out>
+    void EvaluateInto(Out* out, size_t first, size_t last) const {
+        size_t thread_count = thread_count_ > 0 ? thread_count_ : std::max(1u, std::thread::hardware_concurrency());
+        //      
+        thread_count = std::min(thread_count, std::max<size_t>(1, (last - first) / 65536));
+        if (thread_count == 1) {
+            inner_.EvaluateInto(out, first, last);
+            return;
+        }
+        const size_t chunk = (last - first + thread_count - 1) / thread_count;
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        try {
+            for (size_t t = 0; t < thread_count; ++t) {
+                const size_t begin = std::min(last, first + t * chunk);
+                const size_t end = std::min(last, begin + chunk);
+                threads.emplace_back([this, out, begin, end] {
+                    inner_.EvaluateInto(out, begin, end);
+                });
+            }
+        } catch (...) {
+            //  ,    ,  std::terminate
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            throw;
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+private:
+    Inner inner_;
+    size_t thread_count_;
+};
+
+template <typename T>
+struct IsArithmeticVector : std::false_type {};
+
+template <typename Type>
+struct IsArithmeticVector<SimpleVector<Type>> : std::is_arithmetic<Type> {};
+
+template <typename T>
+struct IsParallelExpression : std::false_type {};
+
+template <typename Inner>
+struct IsParallelExpression<ParallelExpression<Inner>> : std::true_type {};
+
+// ParallelExpression  :         
+template <typename T>
+constexpr bool IS_VECTOR_OPERAND = IsArithmeticVector<T>::value
+                                   || (std::is_base_of_v<VectorExpression<T>, T> && !IsParallelExpression<T>::value);
+
+template <typename T>
+constexpr bool IS_OPERAND = IS_VECTOR_OPERAND<T> || std::is_arithmetic_v<T>;
+
+//  ,         
+template <typename Left, typename Right>
+using EnableIfOperands = std::enable_if_t<IS_OPERAND<Left> && IS_OPERAND<Right>
+                                          && (IS_VECTOR_OPERAND<Left> || IS_VECTOR_OPERAND<Right>)>;
+
+//     :    VectorView,    ScalarValue
+template <typename Type>
+VectorView<Type> AsNode(const SimpleVector<Type>& vector) noexcept {
+    return VectorView<Type>(vector);
+}
+
+template <typename Derived>
+const Derived& AsNode(const VectorExpression<Derived>& expression) noexcept {
+    return expression.Self();
+}
+
+template <typename Type, typename = std::enable_if_t<std::is_arithmetic_v<Type>>>
+ScalarValue<Type> AsNode(Type value) noexcept {
+    return ScalarValue<Type>(value);
+}
+
+template <typename Operand>
+size_t GetOperandSize(const Operand& operand) noexcept {
+    if constexpr (std::is_arithmetic_v<Operand>) {
+        return 0;
+    } else {
+        return operand.GetSize();
+    }
+}
+
+//    .  std::invalid_argument,    
+template <typename Operation, typename Left, typename Right>
+auto MakeBinary(const Left& left, const Right& right) {
+    size_t size = GetOperandSize(left);
+    if constexpr (IS_VECTOR_OPERAND<Left> && IS_VECTOR_OPERAND<Right>) {
+        if (size != right.GetSize()) {
+            throw std::invalid_argument("vector sizes differ");
+        }
+    } else if constexpr (!IS_VECTOR_OPERAND<Left>) {
+        size = right.GetSize();
+    }
+    using LeftNode = std::decay_t<decltype(AsNode(left))>;
+    using RightNode = std::decay_t<decltype(AsNode(right))>;
+    return BinaryExpression<Operation, LeftNode, RightNode>(AsNode(left), AsNode(right), size);
+}
+
+template <typename Operation, typename Operand>
+auto MakeUnary(const Operand& operand) {
+    using Node = std::decay_t<decltype(AsNode(operand))>;
+    return UnaryExpression<Operation, Node>(AsNode(operand));
+}
+
+struct SqrtOperation {
+    template <typename T>
+    auto operator()(T value) const noexcept {
+        return std::sqrt(value);
+    }
+};
+
+struct AbsOperation {
+    template <typename T>
+    auto operator()(T value) const noexcept {
+        return std::abs(value);
+    }
+};
+
+struct ExpOperation {
+    template <typename T>
+    auto operator()(T value) const noexcept {
+        return std::exp(value);
+    }
+};
+
+struct LogOperation {
+    template <typename T>
+    auto operator()(T value) const noexcept {
+        return std::log(value);
+    }
+};
+
+struct SinOperation {
+    template <typename T>
+    auto operator()(T value) const noexcept {
+        return std::sin(value);
+    }
+};
+
+struct CosOperation {
+    template <typename T>
+    auto operator()(T value) const noexcept {
+        return std::cos(value);
+    }
+};
+
+struct PowOperation {
+    template <typename T, typename U>
+    auto operator()(T base, U exponent) const noexcept {
+        return std::pow(base, exponent);
+    }
+};
+
+//   ,   
+struct MinOperation {
+    template <typename T, typename U>
+    auto operator()(T lhs, U rhs) const noexcept {
+        using Result = std::common_type_t<T, U>;
+        return rhs < lhs ? static_cast<Result>(rhs) : static_cast<Result>(lhs);
+    }
+};
+
+struct MaxOperation {
+    template <typename T, typename U>
+    auto operator()(T lhs, U rhs) const noexcept {
+        using Result = std::common_type_t<T, U>;
+        return lhs < rhs ? static_cast<Result>(rhs) : static_cast<Result>(lhs);
+    }
+};
+
+}  // namespace expression_detail
+
+template <typename Left, typename Right, typename = expression_detail::EnableIfOperands<Left, Right>>
+auto operator+(const Left& lhs, const Right& rhs) {
+    return expression_detail::MakeBinary<std::plus<>>(lhs, rhs);
+}
+
+template <typename Left, typename Right, typename = expression_detail::EnableIfOperands<Left, Right>>
+auto operator-(const Left& lhs, const Right& rhs) {
+    return expression_detail::MakeBinary<std::minus<>>(lhs, rhs);
+}
+
+template <typename Left, typename Right, typename = expression_detail::EnableIfOperands<Left, Right>>
+auto operator*(const Left& lhs, const Right& rhs) {
+    return expression_detail::MakeBinary<std::multiplies<>>(lhs, rhs);
+}
+
+template <typename Left, typename Right, typename = expression_detail::EnableIfOperands<Left, Right>>
+auto operator/(const Left& lhs, const Right& rhs) {
+    return expression_detail::MakeBinary<std::divides<>>(lhs, rhs);
+}
+
+template <typename Left, typename Right, typename = expression_detail::EnableIfOperands<Left, Right>>
+auto Pow(const Left& base, const Right& exponent) {
+    return expression_detail::MakeBinary<expression_detail::PowOperation>(base, exponent);
+}
+
+template <typename Left, typename Right, typename = expression_detail::EnableIfOperands<Left, Right>>
+auto Min(const Left& lhs, const Right& rhs) {
+    return expression_detail::MakeBinary<expression_detail::MinOperation>(lhs, rhs);
+}
+
+template <typename Left, typename Right, typename = expression_detail::EnableIfOperands<Left, Right>>
+auto Max(const Left& lhs, const Right& rhs) {
+    return expression_detail::MakeBinary<expression_detail::MaxOperation>(lhs, rhs);
+}
+
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto operator-(const Operand& operand) {
+    return expression_detail::MakeUnary<std::negate<>>(operand);
+}
+
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto Sqrt(const Operand& operand) {
+    return expression_detail::MakeUnary<expression_detail::SqrtOperation>(operand);
+}
+
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto Abs(const Operand& operand) {
+    return expression_detail::MakeUnary<expression_detail::AbsOperation>(operand);
+}
+
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto Exp(const Operand& operand) {
+    return expression_detail::MakeUnary<expression_detail::ExpOperation>(operand);
+}
+
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto Log(const Operand& operand) {
+    return expression_detail::MakeUnary<expression_detail::LogOperation>(operand);
+}
+
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto Sin(const Operand& operand) {
+    return expression_detail::MakeUnary<expression_detail::SinOperation>(operand);
+}
+
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto Cos(const Operand& operand) {
+    return expression_detail::MakeUnary<expression_detail::CosOperation>(operand);
+}
+
+//       : r = Parallel(a * b + c).
+// Parallel     : Parallel(a * b) + c  .
+// thread_count == 0  std::thread::hardware_concurrency()
+template <typename Operand, typename = std::enable_if_t<expression_detail::IS_VECTOR_OPERAND<Operand>>>
+auto Parallel(const Operand& operand, size_t thread_count = 0) {
+    using Node = std::decay_t<decltype(expression_detail::AsNode(operand))>;
+    return expression_detail::ParallelExpression<Node>(expression_detail::AsNode(operand), thread_count);
+}